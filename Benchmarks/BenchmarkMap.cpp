@@ -0,0 +1,74 @@
+#include "BenchmarkMap.h"
+#include "Map.h"
+#include "TilesetRegistry.h"
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#pragma region Public Methods
+
+Map* BenchmarkMap::Generate(const std::string& directory, int rowCount, int columnCount, int layerCount, double blockedChance, unsigned int seed, ThreadPool* threadPool)
+{
+	const TilesetHandle tilesetHandle = TilesetRegistry::Load(BENCHMARK_MAP_TILESET_FILEPATH);
+	if (tilesetHandle == INVALID_TILESET_HANDLE)
+	{
+		printf("Unable to load %s\n", BENCHMARK_MAP_TILESET_FILEPATH);
+		return nullptr;
+	}
+
+	//the first walkable and the first blocked tile the tileset has
+	const Tileset& tileset = TilesetRegistry::Get(tilesetHandle);
+	int walkableId = -1;
+	int blockedId = -1;
+	for (int id = 0; id < tileset.tileCount && (walkableId == -1 || blockedId == -1); id++)
+	{
+		if (tileset.walkable[id] && walkableId == -1)
+			walkableId = id;
+		else if (!tileset.walkable[id] && blockedId == -1)
+			blockedId = id;
+	}
+
+	if (walkableId == -1 || blockedId == -1)
+	{
+		printf("%s needs both walkable and blocked tiles\n", BENCHMARK_MAP_TILESET_FILEPATH);
+		return nullptr;
+	}
+
+	std::mt19937 random(seed);
+	std::bernoulli_distribution isBlocked(blockedChance);
+	std::vector<std::string> tileDataFilePathsByLayer;
+
+	for (int layer = 0; layer < layerCount; layer++)
+	{
+		const std::string tileDataFilePath = directory + "/benchmark_" + std::to_string(rowCount) + "x" + std::to_string(columnCount) + "_" + std::to_string(layer) + ".csv";
+		std::ofstream file(tileDataFilePath.c_str(), std::ios::trunc);
+		if (!file.is_open())
+		{
+			printf("Unable to write %s\n", tileDataFilePath.c_str());
+			return nullptr;
+		}
+
+		for (int row = 0; row < rowCount; row++)
+		{
+			for (int column = 0; column < columnCount; column++)
+			{
+				file << (isBlocked(random) ? blockedId : walkableId) << (column + 1 < columnCount ? "," : "\n");
+			}
+		}
+
+		tileDataFilePathsByLayer.push_back(tileDataFilePath);
+	}
+
+	Map* map = new Map(tileDataFilePathsByLayer, tilesetHandle, threadPool);
+	if (!map->GetIsLoaded() || map->GetIsStreamed())
+	{
+		printf("Generated map %dx%d didn't load up front\n", rowCount, columnCount);
+		delete map;
+		return nullptr;
+	}
+
+	return map;
+}
+
+#pragma endregion
\ No newline at end of file
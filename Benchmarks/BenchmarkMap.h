@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+#define BENCHMARK_MAP_TILESET_FILEPATH	"../resources/Raou_Interior_Tileset.tsx"
+
+#pragma region Forward Declarations
+class Map;
+class ThreadPool;
+#pragma endregion
+
+//writes a generated .csv map to a scratch directory and loads it like any other map, for benchmarks that want a big map to work on
+//blocked tiles are scattered at random on every layer, the rest are walkable, run from BlizzGameJam2021/ so the tileset can be found
+class BenchmarkMap
+{
+public:
+	BenchmarkMap() = delete;
+
+	static Map* Generate(const std::string& directory, int rowCount, int columnCount, int layerCount, double blockedChance, unsigned int seed, ThreadPool* threadPool);
+};
\ No newline at end of file
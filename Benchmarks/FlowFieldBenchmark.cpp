@@ -0,0 +1,169 @@
+#include "BenchmarkMap.h"
+#include "Map.h"
+#include "ThreadPool.h"
+#include "FlowField.h"
+#include "Constants.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+//the chasers' FlowField on a 512x512 map with random walls: rebuilds as the player walks from tile to tile, and 10,000 enemies sampling it every frame
+//checks every rebuild against a plain breadth first search over the same window, run from BlizzGameJam2021/ with a scratch directory for the generated map
+
+#define BENCHMARK_MAP_SIZE			512
+#define BENCHMARK_ENEMY_COUNT		10000
+#define BENCHMARK_TARGET_COUNT		500
+#define BENCHMARK_FRAME_COUNT		1000
+#define BENCHMARK_CHECKED_TARGETS	50
+
+static const int rowOffsets[4] = { -1, 1, 0, 0 };
+static const int columnOffsets[4] = { 0, 0, -1, 1 };
+
+//the distances FlowField should come up with, -1 for blocked and unreachable cells like FlowField::GetDistance()
+static int checkAgainstBreadthFirstSearch(const Map* map, const FlowField& flowField)
+{
+	const int radius = flowField.GetRadius();
+	const int windowSize = (radius * 2) + 1;
+	const int originRow = flowField.GetTargetRow() - radius;
+	const int originColumn = flowField.GetTargetColumn() - radius;
+
+	std::vector<int> distances(windowSize * windowSize, -1);
+	std::vector<int> frontier;
+	distances[(radius * windowSize) + radius] = 0;
+	frontier.push_back((radius * windowSize) + radius);
+
+	for (size_t next = 0; next < frontier.size(); next++)
+	{
+		const int windowRow = frontier[next] / windowSize;
+		const int windowColumn = frontier[next] % windowSize;
+
+		for (int i = 0; i < 4; i++)
+		{
+			const int neighbourWindowRow = windowRow + rowOffsets[i];
+			const int neighbourWindowColumn = windowColumn + columnOffsets[i];
+			if (neighbourWindowRow < 0 || neighbourWindowRow >= windowSize || neighbourWindowColumn < 0 || neighbourWindowColumn >= windowSize)
+				continue;
+
+			const int neighbourIndex = (neighbourWindowRow * windowSize) + neighbourWindowColumn;
+			if (distances[neighbourIndex] != -1 || (neighbourWindowRow == radius && neighbourWindowColumn == radius))
+				continue;
+
+			if (!map->IsWalkable(originRow + neighbourWindowRow, originColumn + neighbourWindowColumn))
+				continue;
+
+			distances[neighbourIndex] = distances[frontier[next]] + 1;
+			frontier.push_back(neighbourIndex);
+		}
+	}
+
+	int failureCount = 0;
+	for (int windowRow = 0; windowRow < windowSize; windowRow++)
+	{
+		for (int windowColumn = 0; windowColumn < windowSize; windowColumn++)
+		{
+			const int row = originRow + windowRow;
+			const int column = originColumn + windowColumn;
+			const int distance = flowField.GetDistance(row, column);
+
+			if (distance != distances[(windowRow * windowSize) + windowColumn])
+			{
+				failureCount++;
+				continue;
+			}
+
+			//every step has to lead to a cell one closer
+			const Direction direction = flowField.GetDirection(row, column);
+			if (distance > 0)
+			{
+				const int nextRow = row + (direction == Direction::UP ? -1 : direction == Direction::DOWN ? 1 : 0);
+				const int nextColumn = column + (direction == Direction::LEFT ? -1 : direction == Direction::RIGHT ? 1 : 0);
+				if (flowField.GetDistance(nextRow, nextColumn) != distance - 1)
+					failureCount++;
+			}
+		}
+	}
+
+	return failureCount;
+}
+
+int main(int argc, char* args[])
+{
+	if (argc != 2)
+	{
+		printf("Usage: FlowFieldBenchmark <scratch directory>\n");
+		return 1;
+	}
+
+	ThreadPool threadPool(ThreadPool::GetDefaultThreadCount());
+	Map* map = BenchmarkMap::Generate(args[1], BENCHMARK_MAP_SIZE, BENCHMARK_MAP_SIZE, 1, 0.25, 2021, &threadPool);
+	if (!map)
+		return 1;
+
+	std::mt19937 random(2021);
+	std::uniform_int_distribution<int> anyTile(0, BENCHMARK_MAP_SIZE - 1);
+	std::uniform_int_distribution<int> anyDirection(0, 3);
+
+	//the player wanders one tile at a time, each one a rebuild
+	FlowField flowField(FLOW_FIELD_RADIUS);
+	int targetRow = BENCHMARK_MAP_SIZE / 2;
+	int targetColumn = BENCHMARK_MAP_SIZE / 2;
+	int failureCount = 0;
+	std::chrono::steady_clock::duration rebuildTime = std::chrono::steady_clock::duration::zero();
+
+	for (int target = 0; target < BENCHMARK_TARGET_COUNT; target++)
+	{
+		const int i = anyDirection(random);
+		if (map->IsWalkable(targetRow + rowOffsets[i], targetColumn + columnOffsets[i]))
+		{
+			targetRow += rowOffsets[i];
+			targetColumn += columnOffsets[i];
+		}
+
+		flowField.Invalidate();
+
+		const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+		flowField.Update(map, targetRow, targetColumn);
+		rebuildTime += std::chrono::steady_clock::now() - startTime;
+
+		if (target < BENCHMARK_CHECKED_TARGETS)
+			failureCount += checkAgainstBreadthFirstSearch(map, flowField);
+	}
+
+	//enemies spread over the player's surroundings, partly inside the field and partly outside of it
+	std::uniform_int_distribution<int> nearTarget(-FLOW_FIELD_RADIUS * 2, FLOW_FIELD_RADIUS * 2);
+	std::vector<int> enemyRows(BENCHMARK_ENEMY_COUNT);
+	std::vector<int> enemyColumns(BENCHMARK_ENEMY_COUNT);
+	for (int enemy = 0; enemy < BENCHMARK_ENEMY_COUNT; enemy++)
+	{
+		enemyRows[enemy] = targetRow + nearTarget(random);
+		enemyColumns[enemy] = targetColumn + nearTarget(random);
+	}
+
+	int steppingEnemyCount = 0;
+	const std::chrono::steady_clock::time_point sampleStartTime = std::chrono::steady_clock::now();
+
+	for (int frame = 0; frame < BENCHMARK_FRAME_COUNT; frame++)
+	{
+		for (int enemy = 0; enemy < BENCHMARK_ENEMY_COUNT; enemy++)
+		{
+			if (flowField.GetDirection(enemyRows[enemy], enemyColumns[enemy]) != Direction::NONE)
+				steppingEnemyCount++;
+		}
+	}
+
+	const std::chrono::steady_clock::duration sampleTime = std::chrono::steady_clock::now() - sampleStartTime;
+
+	printf("FlowField on a %dx%d map, radius %d: %.3f ms per rebuild\n", BENCHMARK_MAP_SIZE, BENCHMARK_MAP_SIZE, FLOW_FIELD_RADIUS, std::chrono::duration<double, std::milli>(rebuildTime).count() / BENCHMARK_TARGET_COUNT);
+	printf("%d enemies sampling it: %.3f ms per frame, %d of them on the field\n", BENCHMARK_ENEMY_COUNT, std::chrono::duration<double, std::milli>(sampleTime).count() / BENCHMARK_FRAME_COUNT, steppingEnemyCount / BENCHMARK_FRAME_COUNT);
+
+	delete map;
+
+	if (failureCount > 0)
+	{
+		printf("%d cells differ from a breadth first search\n", failureCount);
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
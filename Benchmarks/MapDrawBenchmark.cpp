@@ -0,0 +1,180 @@
+#include "BenchmarkMap.h"
+#include "Map.h"
+#include "ThreadPool.h"
+#include "Display.h"
+#include "MapTile.h"
+#include "TilesetRegistry.h"
+#include "Constants.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+
+//Map::Draw() on a 256x256, 3 layer map with the camera scrolling across it, baking off so every tile is culled and queued one by one
+//checks the culling queues exactly the tiles that overlap the camera view plus DRAW_CULLING_MARGIN, and times drawing plus the display flush
+//the same frames are then drawn the way tiles were drawn before tilesets had flat source rects, as a baseline to compare against
+//run from BlizzGameJam2021/ with a scratch directory for the generated map
+
+#define BENCHMARK_MAP_SIZE		256
+#define BENCHMARK_LAYER_COUNT	3
+#define BENCHMARK_FRAME_COUNT	5000
+
+//what the culling should come up with, worked out the slow way by testing every tile's drawn rect against the view
+static int countOverlappingTiles(int cameraShiftX, int cameraShiftY)
+{
+	const int left = cameraShiftX - DRAW_CULLING_MARGIN;
+	const int right = cameraShiftX + CAMERA_VIEW_WIDTH + DRAW_CULLING_MARGIN;
+	const int top = cameraShiftY - DRAW_CULLING_MARGIN;
+	const int bottom = cameraShiftY + CAMERA_VIEW_HEIGHT + DRAW_CULLING_MARGIN;
+
+	int columnCount = 0;
+	for (int column = 0; column < BENCHMARK_MAP_SIZE; column++)
+	{
+		const int tileLeft = Map::GetTileStart(column, TILE_WIDTH);
+		if (tileLeft + TILE_WIDTH > left && tileLeft <= right)
+			columnCount++;
+	}
+
+	int rowCount = 0;
+	for (int row = 0; row < BENCHMARK_MAP_SIZE; row++)
+	{
+		const int tileTop = Map::GetTileStart(row, TILE_HEIGHT);
+		if (tileTop + TILE_HEIGHT > top && tileTop <= bottom)
+			rowCount++;
+	}
+
+	return columnCount * rowCount * BENCHMARK_LAYER_COUNT;
+}
+
+//the sprite sheet offsets of a tile, looked up per tile per frame by the old MapTile::Draw()
+struct LegacyTileInfo
+{
+	int spriteSheetRowOffset;
+	int spriteSheetColumnOffset;
+};
+
+typedef std::map<int, const std::map<int, LegacyTileInfo>&> LegacyTileInfoLookup;		// { map id, { tile id, info }}
+
+//the camera position for a frame, a diagonal pan across the map and back, starting and ending past its edges so the clamping gets covered too
+static void getCameraShift(int frame, int& cameraShiftX, int& cameraShiftY)
+{
+	const int mapPixelSize = BENCHMARK_MAP_SIZE * TILE_WIDTH;
+	const int step = (frame * 7) % (2 * (mapPixelSize + CAMERA_VIEW_WIDTH));
+	cameraShiftX = std::min(step, (2 * (mapPixelSize + CAMERA_VIEW_WIDTH)) - step) - CAMERA_VIEW_WIDTH;
+	cameraShiftY = (cameraShiftX * 3) / 4;
+}
+
+//culls like Map::Draw() but queues each tile on its own, with its source rect found through two nested std::map lookups (twice, like the old code did)
+//headless drops the queue without drawing, so no texture is needed
+static void drawLegacy(const Map& map, const LegacyTileInfoLookup& tileInfoLookup, int mapId, int cameraShiftX, int cameraShiftY)
+{
+	const int firstColumn = std::max(0, Map::GetTileAt(cameraShiftX - DRAW_CULLING_MARGIN, TILE_WIDTH));
+	const int lastColumn = std::min(map.GetColumnCount() - 1, Map::GetTileAt(cameraShiftX + CAMERA_VIEW_WIDTH + DRAW_CULLING_MARGIN, TILE_WIDTH));
+	const int firstRow = std::max(0, Map::GetTileAt(cameraShiftY - DRAW_CULLING_MARGIN, TILE_HEIGHT));
+	const int lastRow = std::min(map.GetRowCount() - 1, Map::GetTileAt(cameraShiftY + CAMERA_VIEW_HEIGHT + DRAW_CULLING_MARGIN, TILE_HEIGHT));
+
+	for (int layer = 0; layer < map.GetNumberOfLayers(); layer++)
+	{
+		for (int row = firstRow; row <= lastRow; row++)
+		{
+			for (int column = firstColumn; column <= lastColumn; column++)
+			{
+				const MapTile* tile = map.GetTileByWorldGridLocation(row, column, layer);
+				Display::QueueTextureForRendering(nullptr, (column * TILE_WIDTH) - (TILE_WIDTH / 2) - cameraShiftX, (row * TILE_HEIGHT) - (TILE_HEIGHT / 2) - cameraShiftY, TILE_WIDTH, TILE_HEIGHT, false, tile->GetIsObject() ? RenderLayers::OBJECTS : RenderLayers::GROUND, true, tileInfoLookup.at(mapId).at(tile->GetId()).spriteSheetColumnOffset * TILE_WIDTH, tileInfoLookup.at(mapId).at(tile->GetId()).spriteSheetRowOffset * TILE_HEIGHT);
+			}
+		}
+	}
+}
+
+int main(int argc, char* args[])
+{
+	if (argc != 2)
+	{
+		printf("Usage: MapDrawBenchmark <scratch directory>\n");
+		return 1;
+	}
+
+	//headless so nothing is rendered, the display still counts what gets queued
+	if (!Display::Initialize(true))
+		return 1;
+
+	ThreadPool threadPool(ThreadPool::GetDefaultThreadCount());
+	Map* map = BenchmarkMap::Generate(args[1], BENCHMARK_MAP_SIZE, BENCHMARK_MAP_SIZE, BENCHMARK_LAYER_COUNT, 0.2, 2021, &threadPool);
+	if (!map)
+		return 1;
+
+	int failureCount = 0;
+	unsigned int queuedTileCount = 0;
+	std::chrono::steady_clock::duration drawTime = std::chrono::steady_clock::duration::zero();
+
+	for (int frame = 0; frame < BENCHMARK_FRAME_COUNT; frame++)
+	{
+		int cameraShiftX;
+		int cameraShiftY;
+		getCameraShift(frame, cameraShiftX, cameraShiftY);
+
+		const unsigned int tilesBefore = Display::GetStats().tiles;
+		const std::chrono::steady_clock::time_point drawStartTime = std::chrono::steady_clock::now();
+		map->Draw(cameraShiftX, cameraShiftY);
+		Display::InjectFrame();
+		drawTime += std::chrono::steady_clock::now() - drawStartTime;
+
+		const int tileCount = static_cast<int>(Display::GetStats().tiles - tilesBefore);
+		queuedTileCount += tileCount;
+
+		const int expectedTileCount = countOverlappingTiles(cameraShiftX, cameraShiftY);
+		if (tileCount != expectedTileCount && failureCount++ < 10)
+			printf("Camera at (%d, %d) queued %d tiles, %d overlap the view\n", cameraShiftX, cameraShiftY, tileCount, expectedTileCount);
+	}
+
+	//the old lookup tables, built from the same tileset, they have to agree with its source rects for the comparison to mean anything
+	const Tileset& tileset = TilesetRegistry::Get(TilesetRegistry::Load(BENCHMARK_MAP_TILESET_FILEPATH));
+	std::map<int, LegacyTileInfo> tileIdToInfoLookup;
+	for (int id = 0; id < tileset.tileCount; id++)
+	{
+		const LegacyTileInfo tileInfo = { id / tileset.columnCount, id % tileset.columnCount };
+		tileIdToInfoLookup.insert({ id, tileInfo });
+
+		const SDL_Rect& sourceRect = tileset.sourceRects[id];
+		if ((sourceRect.x != tileInfo.spriteSheetColumnOffset * TILE_WIDTH || sourceRect.y != tileInfo.spriteSheetRowOffset * TILE_HEIGHT) && failureCount++ < 10)
+			printf("Tile %d is at (%d, %d) in the tileset, the old lookup puts it at (%d, %d)\n", id, sourceRect.x, sourceRect.y, tileInfo.spriteSheetColumnOffset * TILE_WIDTH, tileInfo.spriteSheetRowOffset * TILE_HEIGHT);
+	}
+
+	const LegacyTileInfoLookup tileInfoLookup { { 0, tileIdToInfoLookup } };
+	std::chrono::steady_clock::duration legacyDrawTime = std::chrono::steady_clock::duration::zero();
+
+	for (int frame = 0; frame < BENCHMARK_FRAME_COUNT; frame++)
+	{
+		int cameraShiftX;
+		int cameraShiftY;
+		getCameraShift(frame, cameraShiftX, cameraShiftY);
+
+		const unsigned int texturesBefore = Display::GetStats().textures;
+		const std::chrono::steady_clock::time_point drawStartTime = std::chrono::steady_clock::now();
+		drawLegacy(*map, tileInfoLookup, 0, cameraShiftX, cameraShiftY);
+		Display::InjectFrame();
+		legacyDrawTime += std::chrono::steady_clock::now() - drawStartTime;
+
+		const int tileCount = static_cast<int>(Display::GetStats().textures - texturesBefore);
+		const int expectedTileCount = countOverlappingTiles(cameraShiftX, cameraShiftY);
+		if (tileCount != expectedTileCount && failureCount++ < 10)
+			printf("Baseline with the camera at (%d, %d) queued %d tiles, %d overlap the view\n", cameraShiftX, cameraShiftY, tileCount, expectedTileCount);
+	}
+
+	const double drawTimeInMicroseconds = std::chrono::duration<double, std::micro>(drawTime).count();
+	const double legacyDrawTimeInMicroseconds = std::chrono::duration<double, std::micro>(legacyDrawTime).count();
+
+	printf("Map::Draw() on a %dx%d map, %d layers: %.1f us per frame, %.0f tiles queued per frame\n", BENCHMARK_MAP_SIZE, BENCHMARK_MAP_SIZE, BENCHMARK_LAYER_COUNT, drawTimeInMicroseconds / BENCHMARK_FRAME_COUNT, queuedTileCount / static_cast<double>(BENCHMARK_FRAME_COUNT));
+	printf("Nested std::map lookups, one queue entry per tile: %.1f us per frame (%.1fx)\n", legacyDrawTimeInMicroseconds / BENCHMARK_FRAME_COUNT, legacyDrawTimeInMicroseconds / drawTimeInMicroseconds);
+
+	delete map;
+	Display::ShutDown();
+
+	if (failureCount > 0)
+	{
+		printf("%d frames or tiles came out wrong\n", failureCount);
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "SpatialHash.h"
+#include "CollisionKernel.h"
+#include "Constants.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+//SpatialHash::QueryPairs() for 1k, 10k and 100k random 8-40px boxes, about one per 64x64px, against testing every pair
+//the pairs are checked against the brute force ones wherever that finishes in reasonable time, before and after moving every box
+
+#define BENCHMARK_BOX_SPACING		64
+#define BENCHMARK_MIN_BOX_SIZE		8
+#define BENCHMARK_MAX_BOX_SIZE		40
+#define BENCHMARK_MAX_CHECKED_COUNT	10000
+
+struct Box
+{
+	double x;
+	double y;
+	int width;
+	int height;
+};
+
+static void getBruteForcePairs(const std::vector<Box>& boxes, std::vector<std::pair<int, int>>& pairs)
+{
+	//already in the order QueryPairs() sorts into
+	pairs.clear();
+
+	const int count = static_cast<int>(boxes.size());
+	std::vector<int> lefts(count), tops(count), rights(count), bottoms(count);
+	for (int i = 0; i < count; i++)
+	{
+		CollisionKernel::GetEdges(boxes[i].x, boxes[i].y, boxes[i].width, boxes[i].height, lefts[i], tops[i], rights[i], bottoms[i]);
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		for (int j = i + 1; j < count; j++)
+		{
+			if (CollisionKernel::TestEdges(lefts[i], tops[i], rights[i], bottoms[i], lefts[j], tops[j], rights[j], bottoms[j]))
+				pairs.push_back(std::make_pair(i, j));
+		}
+	}
+}
+
+static int runBenchmark(int count, std::mt19937& random)
+{
+	const double worldSize = std::sqrt(static_cast<double>(count)) * BENCHMARK_BOX_SPACING;
+	std::uniform_real_distribution<double> position(0.0, worldSize);
+	std::uniform_int_distribution<int> size(BENCHMARK_MIN_BOX_SIZE, BENCHMARK_MAX_BOX_SIZE);
+	std::uniform_real_distribution<double> step(-4.0, 4.0);
+
+	std::vector<Box> boxes(count);
+	for (Box& box : boxes)
+	{
+		box = { position(random), position(random), size(random), size(random) };
+	}
+
+	SpatialHash spatialHash(SPATIAL_HASH_CELL_SIZE);
+	for (int id = 0; id < count; id++)
+	{
+		spatialHash.Insert(id, boxes[id].x, boxes[id].y, boxes[id].width, boxes[id].height);
+	}
+
+	const bool isChecked = count <= BENCHMARK_MAX_CHECKED_COUNT;
+	const int repeatCount = std::max(1, 100000 / count);
+	std::vector<std::pair<int, int>> pairs;
+	std::vector<std::pair<int, int>> expectedPairs;
+	int failureCount = 0;
+
+	const std::chrono::steady_clock::time_point pairsStartTime = std::chrono::steady_clock::now();
+	for (int repeat = 0; repeat < repeatCount; repeat++)
+	{
+		spatialHash.QueryPairs(pairs);
+	}
+	const double pairsTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - pairsStartTime).count() / repeatCount;
+
+	printf("%6d boxes: pairs %.3f ms (%d pairs)", count, pairsTime, static_cast<int>(pairs.size()));
+
+	if (isChecked)
+	{
+		const std::chrono::steady_clock::time_point bruteForceStartTime = std::chrono::steady_clock::now();
+		getBruteForcePairs(boxes, expectedPairs);
+		const double bruteForceTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - bruteForceStartTime).count();
+
+		printf(", brute force %.3f ms", bruteForceTime);
+
+		if (pairs != expectedPairs)
+			failureCount++;
+	}
+
+	//everything moves a few pixels, like a frame of entities walking around
+	const std::chrono::steady_clock::time_point updateStartTime = std::chrono::steady_clock::now();
+	for (int id = 0; id < count; id++)
+	{
+		boxes[id].x += step(random);
+		boxes[id].y += step(random);
+		spatialHash.Update(id, boxes[id].x, boxes[id].y, boxes[id].width, boxes[id].height);
+	}
+	const double updateTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - updateStartTime).count();
+
+	printf(", updating every box %.3f ms\n", updateTime);
+
+	if (isChecked)
+	{
+		spatialHash.QueryPairs(pairs);
+		getBruteForcePairs(boxes, expectedPairs);
+
+		if (pairs != expectedPairs)
+			failureCount++;
+	}
+
+	if (failureCount > 0)
+		printf("%6d boxes: pairs differ from brute force\n", count);
+
+	return failureCount;
+}
+
+int main()
+{
+	std::mt19937 random(2021);
+	int failureCount = 0;
+
+	printf("SpatialHash, %dpx cells, %s collision kernel\n", SPATIAL_HASH_CELL_SIZE, CollisionKernel::GetInstructionSetName(CollisionKernel::GetInstructionSet()));
+
+	const int counts[] = { 1000, 10000, 100000 };
+	for (int count : counts)
+	{
+		failureCount += runBenchmark(count, random);
+	}
+
+	return failureCount > 0 ? 1 : 0;
+}
\ No newline at end of file
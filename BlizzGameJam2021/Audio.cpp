@@ -5,8 +5,12 @@
 #include <iostream>
 
 #pragma region Public Methods
-bool Audio::Initialize()
+bool Audio::Initialize(bool isHeadless /*= false*/)
 {
+	Audio::isHeadless = isHeadless;
+	if (isHeadless)
+		return true;
+
 	//Initialize SDL_mixer
 	if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0)
 	{
@@ -37,6 +41,9 @@ bool Audio::ShutDown()
 
 void Audio::PlayAudio(AudioTracks track, bool loop)
 {
+	if (Audio::isHeadless)
+		return;
+
 	int channel = Mix_PlayChannel(-1, Audio::audioTrackData[track], loop ? -1 : 0);
 
 	//update volume for this channel based on the track
@@ -45,6 +52,7 @@ void Audio::PlayAudio(AudioTracks track, bool loop)
 #pragma endregion
 
 #pragma region Static Member Initialization
+bool Audio::isHeadless = false;
 std::map<Audio::AudioTracks, Mix_Chunk*> Audio::audioTrackData;
 std::map<Audio::AudioTracks, int> Audio::audioTrackToChannelMap
 {
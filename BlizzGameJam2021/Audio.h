@@ -16,7 +16,7 @@ public:
 		PLAYER_HIT
 	};
 
-	static bool Initialize();
+	static bool Initialize(bool isHeadless = false);
 	static bool ShutDown();
 
 	static void PlayAudio(AudioTracks track, bool loop);
@@ -24,6 +24,7 @@ public:
 	Audio() = delete;
 
 private:
+	static bool isHeadless;		//no audio device, nothing is loaded or played
 	static std::map<Audio::AudioTracks, Mix_Chunk*> audioTrackData;
 	static std::map<Audio::AudioTracks, int> audioTrackToChannelMap;
 };
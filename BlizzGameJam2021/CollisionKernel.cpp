@@ -0,0 +1,277 @@
+#include "CollisionKernel.h"
+
+//SSE2 is part of every x64 cpu, AVX2 gets compiled in no matter what the build flags say and is only used once the cpu reports it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <immintrin.h>
+	#define COLLISION_KERNEL_SSE2
+
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#define COLLISION_KERNEL_AVX2
+		#define COLLISION_KERNEL_AVX2_FUNCTION
+	#elif defined(__GNUC__)
+		#define COLLISION_KERNEL_AVX2
+		#define COLLISION_KERNEL_AVX2_FUNCTION __attribute__((target("avx2")))
+	#endif
+#endif
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Public Methods
+
+void PackedBoxes::Clear()
+{
+	this->lefts.clear();
+	this->tops.clear();
+	this->rights.clear();
+	this->bottoms.clear();
+}
+
+int PackedBoxes::Add(double x, double y, int width, int height)
+{
+	int left, top, right, bottom;
+	CollisionKernel::GetEdges(x, y, width, height, left, top, right, bottom);
+
+	return this->AddEdges(left, top, right, bottom);
+}
+
+int PackedBoxes::AddEdges(int left, int top, int right, int bottom)
+{
+	this->lefts.push_back(left);
+	this->tops.push_back(top);
+	this->rights.push_back(right);
+	this->bottoms.push_back(bottom);
+
+	return static_cast<int>(this->lefts.size()) - 1;
+}
+
+int PackedBoxes::GetCount() const
+{
+	return static_cast<int>(this->lefts.size());
+}
+
+void CollisionKernel::GetEdges(double x, double y, int width, int height, int& left, int& top, int& right, int& bottom)
+{
+	//positions are centre points, half sizes round down before the doubles get truncated
+	const int halfWidth = width / 2;
+	const int halfHeight = height / 2;
+
+	left = static_cast<int>(x - halfWidth);
+	right = static_cast<int>(x + halfWidth);
+	top = static_cast<int>(y - halfHeight);
+	bottom = static_cast<int>(y + halfHeight);
+}
+
+bool CollisionKernel::TestEdges(int leftA, int topA, int rightA, int bottomA, int leftB, int topB, int rightB, int bottomB)
+{
+	//if any of the sides from A are outside of B there's no overlap
+	if (bottomA <= topB || topA >= bottomB || rightA <= leftB || leftA >= rightB)
+		return false;
+
+	return true;
+}
+
+void CollisionKernel::TestOne(int left, int top, int right, int bottom, const PackedBoxes& boxes, int first, int count, std::vector<unsigned int>& hitMask)
+{
+	//bit i of hitMask is set if boxes[first + i] overlaps the given box
+#if _DEBUG
+	assert(first >= 0 && count >= 0 && first + count <= boxes.GetCount());
+#endif
+
+	CollisionKernel::resetHitMask(hitMask, count);
+
+	const int* lefts = boxes.lefts.data() + first;
+	const int* tops = boxes.tops.data() + first;
+	const int* rights = boxes.rights.data() + first;
+	const int* bottoms = boxes.bottoms.data() + first;
+	int i = 0;
+
+	switch (CollisionKernel::instructionSet)
+	{
+#if defined(COLLISION_KERNEL_AVX2)
+	case COLLISION_INSTRUCTION_SET_AVX2:
+		i = CollisionKernel::testOneAvx2(left, top, right, bottom, lefts, tops, rights, bottoms, count, hitMask.data());
+		break;
+#endif
+
+#if defined(COLLISION_KERNEL_SSE2)
+	case COLLISION_INSTRUCTION_SET_SSE2:
+		i = CollisionKernel::testOneSse2(left, top, right, bottom, lefts, tops, rights, bottoms, count, hitMask.data());
+		break;
+#endif
+
+	default:
+		break;
+	}
+
+	//whatever doesn't fill a whole vector
+	for (; i < count; i++)
+	{
+		if (CollisionKernel::TestEdges(left, top, right, bottom, lefts[i], tops[i], rights[i], bottoms[i]))
+			hitMask[i / 32] |= 1u << (i % 32);
+	}
+}
+
+void CollisionKernel::TestOneScalar(int left, int top, int right, int bottom, const PackedBoxes& boxes, int first, int count, std::vector<unsigned int>& hitMask)
+{
+	//reference version, same results as the SIMD paths one box at a time
+	CollisionKernel::resetHitMask(hitMask, count);
+
+	for (int i = 0; i < count; i++)
+	{
+		const int box = first + i;
+		if (CollisionKernel::TestEdges(left, top, right, bottom, boxes.lefts[box], boxes.tops[box], boxes.rights[box], boxes.bottoms[box]))
+			hitMask[i / 32] |= 1u << (i % 32);
+	}
+}
+
+bool CollisionKernel::GetHit(const std::vector<unsigned int>& hitMask, int index)
+{
+	return (hitMask[index / 32] >> (index % 32)) & 1u;
+}
+
+bool CollisionKernel::IsInstructionSetSupported(CollisionInstructionSet instructionSet)
+{
+	//every set up to the best one the cpu has is usable, scalar always is
+	return instructionSet >= COLLISION_INSTRUCTION_SET_SCALAR && instructionSet <= CollisionKernel::supportedInstructionSet;
+}
+
+bool CollisionKernel::SetInstructionSet(CollisionInstructionSet instructionSet)
+{
+	if (!CollisionKernel::IsInstructionSetSupported(instructionSet))
+		return false;
+
+	CollisionKernel::instructionSet = instructionSet;
+
+	return true;
+}
+
+CollisionInstructionSet CollisionKernel::GetInstructionSet()
+{
+	return CollisionKernel::instructionSet;
+}
+
+const char* CollisionKernel::GetInstructionSetName(CollisionInstructionSet instructionSet)
+{
+	switch (instructionSet)
+	{
+	case COLLISION_INSTRUCTION_SET_AVX2:
+		return "AVX2";
+
+	case COLLISION_INSTRUCTION_SET_SSE2:
+		return "SSE2";
+
+	default:
+		return "scalar";
+	}
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+void CollisionKernel::resetHitMask(std::vector<unsigned int>& hitMask, int count)
+{
+	hitMask.assign((count + 31) / 32, 0);
+}
+
+#if defined(COLLISION_KERNEL_SSE2)
+int CollisionKernel::testOneSse2(int left, int top, int right, int bottom, const int* lefts, const int* tops, const int* rights, const int* bottoms, int count, unsigned int* hitMask)
+{
+	//returns how many boxes got tested, the caller handles whatever doesn't fill a whole vector
+	int i = 0;
+
+	const __m128i leftA = _mm_set1_epi32(left);
+	const __m128i topA = _mm_set1_epi32(top);
+	const __m128i rightA = _mm_set1_epi32(right);
+	const __m128i bottomA = _mm_set1_epi32(bottom);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m128i leftB = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lefts + i));
+		const __m128i topB = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tops + i));
+		const __m128i rightB = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rights + i));
+		const __m128i bottomB = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottoms + i));
+
+		//bottomA > topB && bottomB > topA && rightA > leftB && rightB > leftA
+		__m128i hit = _mm_cmpgt_epi32(bottomA, topB);
+		hit = _mm_and_si128(hit, _mm_cmpgt_epi32(bottomB, topA));
+		hit = _mm_and_si128(hit, _mm_cmpgt_epi32(rightA, leftB));
+		hit = _mm_and_si128(hit, _mm_cmpgt_epi32(rightB, leftA));
+
+		hitMask[i / 32] |= static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(hit))) << (i % 32);
+	}
+
+	return i;
+}
+#endif
+
+#if defined(COLLISION_KERNEL_AVX2)
+COLLISION_KERNEL_AVX2_FUNCTION
+int CollisionKernel::testOneAvx2(int left, int top, int right, int bottom, const int* lefts, const int* tops, const int* rights, const int* bottoms, int count, unsigned int* hitMask)
+{
+	int i = 0;
+
+	const __m256i leftA = _mm256_set1_epi32(left);
+	const __m256i topA = _mm256_set1_epi32(top);
+	const __m256i rightA = _mm256_set1_epi32(right);
+	const __m256i bottomA = _mm256_set1_epi32(bottom);
+
+	for (; i + 8 <= count; i += 8)
+	{
+		const __m256i leftB = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lefts + i));
+		const __m256i topB = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tops + i));
+		const __m256i rightB = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rights + i));
+		const __m256i bottomB = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bottoms + i));
+
+		__m256i hit = _mm256_cmpgt_epi32(bottomA, topB);
+		hit = _mm256_and_si256(hit, _mm256_cmpgt_epi32(bottomB, topA));
+		hit = _mm256_and_si256(hit, _mm256_cmpgt_epi32(rightA, leftB));
+		hit = _mm256_and_si256(hit, _mm256_cmpgt_epi32(rightB, leftA));
+
+		hitMask[i / 32] |= static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(hit))) << (i % 32);
+	}
+
+	return i;
+}
+#endif
+
+CollisionInstructionSet CollisionKernel::detectInstructionSet()
+{
+#if defined(COLLISION_KERNEL_AVX2) && defined(_MSC_VER)
+	//AVX2 needs the cpu to have it (leaf 7) and the os to save the ymm registers (osxsave + xgetbv)
+	int info[4];
+	__cpuid(info, 0);
+
+	if (info[0] >= 7)
+	{
+		__cpuid(info, 1);
+		const bool hasAvx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+
+		__cpuidex(info, 7, 0);
+		if (hasAvx && (info[1] & (1 << 5)))
+			return COLLISION_INSTRUCTION_SET_AVX2;
+	}
+#elif defined(COLLISION_KERNEL_AVX2)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return COLLISION_INSTRUCTION_SET_AVX2;
+#endif
+
+#if defined(COLLISION_KERNEL_SSE2)
+	return COLLISION_INSTRUCTION_SET_SSE2;
+#else
+	return COLLISION_INSTRUCTION_SET_SCALAR;
+#endif
+}
+
+#pragma endregion
+
+#pragma region Static Member Initialization
+
+CollisionInstructionSet CollisionKernel::supportedInstructionSet = CollisionKernel::detectInstructionSet();
+CollisionInstructionSet CollisionKernel::instructionSet = CollisionKernel::supportedInstructionSet;
+
+#pragma endregion
\ No newline at end of file
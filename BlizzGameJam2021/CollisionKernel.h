@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+//boxes as four parallel arrays of integer edges, the layout the CollisionKernel tests want
+struct PackedBoxes
+{
+	std::vector<int> lefts;
+	std::vector<int> tops;
+	std::vector<int> rights;	//exclusive, like bottoms
+	std::vector<int> bottoms;
+
+	void Clear();
+	int Add(double x, double y, int width, int height);
+	int AddEdges(int left, int top, int right, int bottom);
+	int GetCount() const;
+};
+
+//which code path CollisionKernel::TestOne() runs, picked from what the cpu supports when the game starts
+enum CollisionInstructionSet
+{
+	COLLISION_INSTRUCTION_SET_SCALAR = 0,
+	COLLISION_INSTRUCTION_SET_SSE2,
+	COLLISION_INSTRUCTION_SET_AVX2,
+	NUM_COLLISION_INSTRUCTION_SETS
+};
+
+//overlap tests for whole batches of boxes at once, SIMD where the cpu lets us (AVX2, then SSE2), plain loops otherwise
+//every test follows the rules Object::TestCollision() always has: centre +/- half size truncated to ints, touching edges don't overlap
+class CollisionKernel
+{
+public:
+	CollisionKernel() = delete;
+
+	static void GetEdges(double x, double y, int width, int height, int& left, int& top, int& right, int& bottom);
+	static bool TestEdges(int leftA, int topA, int rightA, int bottomA, int leftB, int topB, int rightB, int bottomB);
+
+	static void TestOne(int left, int top, int right, int bottom, const PackedBoxes& boxes, int first, int count, std::vector<unsigned int>& hitMask);
+	static void TestOneScalar(int left, int top, int right, int bottom, const PackedBoxes& boxes, int first, int count, std::vector<unsigned int>& hitMask);
+
+	static bool GetHit(const std::vector<unsigned int>& hitMask, int index);
+
+	static bool IsInstructionSetSupported(CollisionInstructionSet instructionSet);
+	static bool SetInstructionSet(CollisionInstructionSet instructionSet);
+	static CollisionInstructionSet GetInstructionSet();
+	static const char* GetInstructionSetName(CollisionInstructionSet instructionSet);
+
+private:
+	static void resetHitMask(std::vector<unsigned int>& hitMask, int count);
+	static int testOneSse2(int left, int top, int right, int bottom, const int* lefts, const int* tops, const int* rights, const int* bottoms, int count, unsigned int* hitMask);
+	static int testOneAvx2(int left, int top, int right, int bottom, const int* lefts, const int* tops, const int* rights, const int* bottoms, int count, unsigned int* hitMask);
+	static CollisionInstructionSet detectInstructionSet();
+
+	static CollisionInstructionSet supportedInstructionSet;
+	static CollisionInstructionSet instructionSet;
+};
\ No newline at end of file
@@ -4,19 +4,7 @@
 #define FONT_FILEPATH								"../resources/Fonts/Orbitron/Orbitron-Regular.ttf"
 #define HEART_TEXTURE_PATH							"../resources/Hearts.png"
 #define PLAYER_TEXTURE_PATH							"../resources/player.png"
-#define STARTING_HOUSE_MAP_DATA_FILEPATH0			"../resources/maps/starting_house_Base.csv"
-#define STARTING_HOUSE_MAP_DATA_FILEPATH1			"../resources/maps/starting_house_Objects-low.csv"
-#define STARTING_HOUSE_MAP_DATA_FILEPATH2			"../resources/maps/starting_house_Objects-high.csv"
-#define STARTING_HOUSE_MAP_TELEPORTERS_FILEPATH		"../resources/maps/starting_house_teleporters.txt"
-#define STARTING_HOUSE_MAP_SPAWNS_FILEPATH			"../resources/maps/starting_house_spawns.txt"
-#define INTERIOR_TILESET_WALKABLE_DATA_FILEPATH		"../resources/interior_tileset_walkable.txt"
-#define INTERIOR_TILESET_ISOBJECT_DATA_FILEPATH		"../resources/interior_tileset_isObject.txt"
-#define INTERIOR_TILESET_TEXTURE_FILEPATH			"../resources/raou_interior_tptileset/top-down_interior_v2.png"
-#define TEST_BUILDING_MAP_DATA_FILEPATH0			"../resources/maps/test_building_Base.csv"
-#define TEST_BUILDING_MAP_DATA_FILEPATH1			"../resources/maps/test_building_Objects-low.csv"
-#define TEST_BUILDING_MAP_DATA_FILEPATH2			"../resources/maps/test_building_Objects-high.csv"
-#define TEST_BUILDING_MAP_TELEPORTERS_FILEPATH		"../resources/maps/test_building_teleporters.txt"
-#define TEST_BUILDING_MAP_SPAWNS_FILEPATH			"../resources/maps/test_building_spawns.txt"
+#define MAPS_MANIFEST_FILEPATH						"../resources/maps/maps.txt"
 
 #define BG_MUSIC_AUDIO_FILEPATH						"../resources/audio/bg_music.wav"
 #define PLAYER_HIT_AUDIO_FILEPATH					"../resources/audio/player_hit.wav"
@@ -38,9 +26,44 @@
 #define SCREEN_WIDTH					800
 #define SCREEN_HEIGHT					600
 
+#define CAMERA_VIEW_WIDTH				(int)(SCREEN_WIDTH / RENDER_SCALE_AMOUNT)	//area of the world actually visible on screen
+#define CAMERA_VIEW_HEIGHT				(int)(SCREEN_HEIGHT / RENDER_SCALE_AMOUNT)
+#define DRAW_CULLING_MARGIN				TILE_WIDTH	//extra pixels around the camera view that still get drawn
+
 #define TILE_WIDTH						16
 #define TILE_HEIGHT						16
 
+#define DEFAULT_EMPTY_MAP_TILE_ID		853
+
+#define MAP_BAKE_STATIC_LAYERS				1					//pre-render map layers into chunk textures at load instead of queueing every tile each frame
+#define MAP_BAKED_CHUNK_SIZE				256					//in pixels, per side, should be a multiple of TILE_WIDTH/TILE_HEIGHT
+
+#define MAP_CHUNK_SIZE						32					//in tiles, per side
+#define MAP_RESIDENT_CHUNK_BUDGET			64					//chunks kept in memory before the least recently used ones are evicted
+#define MAP_CHUNK_STREAMING_MARGIN			1					//in chunks, loaded around the camera view ahead of time
+#define MAP_CHUNK_STREAMING_MIN_FILE_SIZE	(1024 * 1024)		//in bytes, layer files at least this big are streamed in chunks instead of loaded up front
+
+#define THREAD_POOL_MAX_THREADS				16
+#define CSV_MAP_JOBS_PER_THREAD				4					//row ranges queued per loader thread, so uneven rows still balance out
+#define CSV_MAP_MIN_ROWS_PER_JOB			32					//below this a job isn't worth the handoff
+
+#define WORLD_CACHE_BYTE_BUDGET				(64 * 1024 * 1024)	//in bytes, recently left maps kept in memory before the least recently used ones are dropped
+#define WORLD_CACHE_RESTORE_ENTITY_STATE	1					//re-entering a cached map keeps its spawns where they were, 0 puts them back where the spawns file has them
+
+#define FLOW_FIELD_RADIUS					32					//in tiles, enemies further than this from the player fall back to heading straight for them
+#define SPATIAL_HASH_CELL_SIZE				(TILE_WIDTH * 2)	//in pixels, per side, keep it a multiple of the tile size so cells line up with tiles
+#define ENTITY_JOB_GRAIN_SIZE				1024				//entities per job system chunk, small enough to steal and balance, big enough to outweigh the handoff
+#define ENTITY_RUNTIME_ENEMY_CAPACITY		64					//slots reserved per map for enemies spawned during play, more still fit but grow the arrays
+#define MAP_ARENA_BLOCK_SIZE				(256 * 1024)		//in bytes, each map's arena grabs memory from the system this much at a time
+
+#define SIMULATION_TICK_TIME				8					//in milliseconds, the fixed step everything is simulated in (125 ticks a second)
+#define SIMULATION_MAX_TICKS_PER_FRAME		8					//ticks a single frame may run to catch up, anything beyond that is dropped
+
+#define SIMULATION_FULL_RATE_MARGIN			(TILE_WIDTH * 4)	//in pixels, entities this close to the camera view update every frame
+#define SIMULATION_REDUCED_RATE_MARGIN		(TILE_WIDTH * 40)	//in pixels, entities further than this from the camera view go dormant
+#define SIMULATION_REDUCED_RATE_INTERVAL	100					//in milliseconds, how often entities between the two margins update
+#define SIMULATION_WAKE_DURATION			2000				//in milliseconds, woken entities update every frame for this long wherever they are
+
 #define TELEPORTER_WIDTH				TILE_WIDTH
 #define TELEPORTER_HEIGHT				1		//1 so you have to slightly walk into the door/portal area to actually be teleported
 
@@ -68,4 +91,6 @@
 
 #define JOYSTICK_DEAD_ZONE				8000
 
+#define STARTING_MAP_NAME				"starting_house"	//name from the maps manifest
+
 #define WINDOW_TITLE					"BlizzGameJam2021"
\ No newline at end of file
@@ -0,0 +1,250 @@
+#include "CsvMapLoader.h"
+#include "ThreadPool.h"
+#include "Constants.h"
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <cctype>
+#include <stdio.h>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+namespace
+{
+	//a whole layer file in memory plus where each of its (non-empty) rows sits in it
+	struct CsvLayerText
+	{
+		std::string text;
+		std::vector<size_t> rowStarts;
+		std::vector<size_t> rowEnds;
+		bool readSuccess = false;
+	};
+
+	//what went wrong in a range of rows, the first problem found is kept
+	struct CsvRowRangeResult
+	{
+		int badRow = -1;
+		int badRowColumnCount = 0;
+		int badTileId = -1;
+	};
+
+	bool readLayerText(const std::string& filepath, CsvLayerText& layer)
+	{
+		std::ifstream file(filepath.c_str(), std::ios::binary);
+
+		if (!file.is_open())
+			return false;
+
+		file.seekg(0, std::ios::end);
+		const std::streamoff fileSize = file.tellg();
+		file.seekg(0, std::ios::beg);
+
+		if (fileSize < 0)
+			return false;
+
+		layer.text.resize(static_cast<size_t>(fileSize));
+		if (fileSize > 0)
+			file.read(&layer.text[0], fileSize);
+
+		if (file.fail())
+			return false;
+
+		//blank lines (including a trailing one) don't count as rows
+		size_t lineStart = 0;
+		while (lineStart < layer.text.size())
+		{
+			const char* newline = static_cast<const char*>(memchr(layer.text.data() + lineStart, '\n', layer.text.size() - lineStart));
+			const size_t lineEnd = newline ? newline - layer.text.data() : layer.text.size();
+
+			size_t firstCharacter = lineStart;
+			while (firstCharacter < lineEnd && isspace(static_cast<unsigned char>(layer.text[firstCharacter])))
+				firstCharacter++;
+
+			if (firstCharacter < lineEnd)
+			{
+				layer.rowStarts.push_back(lineStart);
+				layer.rowEnds.push_back(lineEnd);
+			}
+
+			lineStart = lineEnd + 1;
+		}
+
+		return true;
+	}
+
+	void parseRowRange(const CsvLayerText& layer, const Tileset& tileset, int firstRow, int lastRow, int columnCount, std::vector<MapTile>& mapTiles, CsvRowRangeResult& result)
+	{
+		for (int row = firstRow; row <= lastRow; row++)
+		{
+			MapTile* rowTiles = mapTiles.data() + (static_cast<size_t>(row) * columnCount);
+
+			const int rowColumnCount = CsvMapLoader::ParseRow(layer.text.data() + layer.rowStarts[row], layer.text.data() + layer.rowEnds[row], &tileset, rowTiles, 0, columnCount, result.badTileId);
+
+			if (rowColumnCount != columnCount || result.badTileId != -1)
+			{
+				result.badRow = row;
+				result.badRowColumnCount = rowColumnCount;
+				return;
+			}
+		}
+	}
+}
+
+#pragma region Public Methods
+
+bool CsvMapLoader::Load(const std::vector<std::string>& tileDataFilePathsByLayer, TilesetHandle tilesetHandle, ThreadPool* threadPool, std::vector<std::vector<MapTile>>& tilesByLayer, int& rowCount, int& columnCount)
+{
+	const int numberOfLayers = tileDataFilePathsByLayer.size();
+
+#if _DEBUG
+	assert(numberOfLayers > 0);
+	assert(tilesetHandle != INVALID_TILESET_HANDLE);
+	assert(threadPool);
+#endif
+
+	const Tileset& tileset = TilesetRegistry::Get(tilesetHandle);
+
+	//pull every layer into memory at once, the files are independent
+	std::vector<CsvLayerText> layers(numberOfLayers);
+	for (int layer = 0; layer < numberOfLayers; layer++)
+	{
+		threadPool->Enqueue([&tileDataFilePathsByLayer, &layers, layer]()
+		{
+			layers[layer].readSuccess = readLayerText(tileDataFilePathsByLayer[layer], layers[layer]);
+		});
+	}
+	threadPool->Wait();
+
+	for (int layer = 0; layer < numberOfLayers; layer++)
+	{
+		if (!layers[layer].readSuccess)
+		{
+			printf("Unable to read map layer %s\n", tileDataFilePathsByLayer[layer].c_str());
+			return false;
+		}
+	}
+
+	//every layer has to cover the same grid, the first row of the first layer decides the width
+	rowCount = layers[0].rowStarts.size();
+	if (rowCount == 0)
+	{
+		printf("Map layer %s is empty\n", tileDataFilePathsByLayer[0].c_str());
+		return false;
+	}
+
+	int unusedBadTileId = -1;
+	columnCount = CsvMapLoader::ParseRow(layers[0].text.data() + layers[0].rowStarts[0], layers[0].text.data() + layers[0].rowEnds[0], nullptr, nullptr, 0, 0, unusedBadTileId);
+
+	for (int layer = 1; layer < numberOfLayers; layer++)
+	{
+		const int layerRowCount = layers[layer].rowStarts.size();
+		if (layerRowCount != rowCount)
+		{
+			printf("Map layer %s has %d rows but %s has %d\n", tileDataFilePathsByLayer[layer].c_str(), layerRowCount, tileDataFilePathsByLayer[0].c_str(), rowCount);
+			return false;
+		}
+	}
+
+	//cut each layer into row ranges, enough of them to keep every thread busy even with a single layer
+	const int jobsPerLayer = std::max(1, (threadPool->GetThreadCount() * CSV_MAP_JOBS_PER_THREAD) / numberOfLayers);
+	const int rowsPerJob = std::max(CSV_MAP_MIN_ROWS_PER_JOB, (rowCount + jobsPerLayer - 1) / jobsPerLayer);
+	const int rangesPerLayer = (rowCount + rowsPerJob - 1) / rowsPerJob;
+
+	tilesByLayer.clear();
+	tilesByLayer.resize(numberOfLayers);
+
+	std::vector<CsvRowRangeResult> results(numberOfLayers * rangesPerLayer);
+	for (int layer = 0; layer < numberOfLayers; layer++)
+	{
+		tilesByLayer[layer].resize(static_cast<size_t>(rowCount) * columnCount);
+
+		for (int range = 0; range < rangesPerLayer; range++)
+		{
+			const int firstRow = range * rowsPerJob;
+			const int lastRow = std::min(rowCount, firstRow + rowsPerJob) - 1;
+
+			//each range writes to its own rows and its own result, so nothing is shared
+			CsvRowRangeResult& result = results[(layer * rangesPerLayer) + range];
+			threadPool->Enqueue([&layers, &tileset, &tilesByLayer, &result, layer, firstRow, lastRow, columnCount]()
+			{
+				parseRowRange(layers[layer], tileset, firstRow, lastRow, columnCount, tilesByLayer[layer], result);
+			});
+		}
+	}
+	threadPool->Wait();
+
+	//report the first problem in file order, same as a sequential read would have
+	for (int layer = 0; layer < numberOfLayers; layer++)
+	{
+		for (int range = 0; range < rangesPerLayer; range++)
+		{
+			const CsvRowRangeResult& result = results[(layer * rangesPerLayer) + range];
+			if (result.badRow == -1)
+				continue;
+
+			if (result.badTileId != -1)
+				printf("Map layer %s row %d uses tile id %d but the tileset only has %d tiles\n", tileDataFilePathsByLayer[layer].c_str(), result.badRow, result.badTileId, tileset.tileCount);
+			else
+				printf("Map layer %s row %d has %d columns but the map is %d wide\n", tileDataFilePathsByLayer[layer].c_str(), result.badRow, result.badRowColumnCount, columnCount);
+
+			tilesByLayer.clear();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int CsvMapLoader::ParseRow(const char* position, const char* end, const Tileset* tileset, MapTile* rowTiles, int firstColumn, int columnCount, int& badTileId)
+{
+	int rowColumnCount = 0;
+
+	while (position < end)
+	{
+		const char* fieldEnd = static_cast<const char*>(memchr(position, ',', end - position));
+		if (fieldEnd == nullptr)
+			fieldEnd = end;
+
+		while (position < fieldEnd && isspace(static_cast<unsigned char>(*position)))
+			position++;
+
+		if (position < fieldEnd)
+		{
+			bool negative = false;
+			if (*position == '-' || *position == '+')
+			{
+				negative = *position == '-';
+				position++;
+			}
+
+			int id = 0;
+			while (position < fieldEnd && *position >= '0' && *position <= '9')
+			{
+				id = (id * 10) + (*position - '0');
+				position++;
+			}
+
+			if (negative && id > 0)
+				id = DEFAULT_EMPTY_MAP_TILE_ID;
+
+			//a long row gets reported by the caller, just don't write past it
+			if (rowTiles && rowColumnCount >= firstColumn && rowColumnCount < firstColumn + columnCount)
+			{
+				if (id < tileset->tileCount)
+					rowTiles[rowColumnCount - firstColumn] = MapTile(*tileset, id);
+				else if (badTileId == -1)
+					badTileId = id;
+			}
+
+			rowColumnCount++;
+		}
+
+		position = fieldEnd + 1;
+	}
+
+	return rowColumnCount;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "MapTile.h"
+#include <string>
+#include <vector>
+
+#pragma region Forward Declarations
+class ThreadPool;
+#pragma endregion
+
+//reads a map exported from Tiled as one .csv per layer, every layer and every range of rows is parsed in parallel on the caller's thread pool
+class CsvMapLoader
+{
+public:
+	CsvMapLoader() = delete;
+
+	static bool Load(const std::vector<std::string>& tileDataFilePathsByLayer, TilesetHandle tilesetHandle, ThreadPool* threadPool, std::vector<std::vector<MapTile>>& tilesByLayer, int& rowCount, int& columnCount);
+
+	//same rules the old strtok/atoi reader used: empty fields are skipped, anything after the digits is ignored
+	//fills rowTiles (if given) with the columnCount columns starting at firstColumn and returns how many fields the whole row has
+	//ids the tileset doesn't have are left out of rowTiles, the first one goes in badTileId (callers start it at -1)
+	static int ParseRow(const char* position, const char* end, const Tileset* tileset, MapTile* rowTiles, int firstColumn, int columnCount, int& badTileId);
+};
\ No newline at end of file
@@ -10,8 +10,34 @@
 
 #pragma region Public Methods
 
-bool Display::Initialize()
+bool Display::Initialize(bool isHeadless /*= false*/)
 {
+	Display::renderThreadId = std::this_thread::get_id();
+	Display::isHeadless = isHeadless;
+
+	//init layer opacities
+	Display::layerOpacity =
+	{
+		{ RenderLayers::GROUND, 255 },
+		{ RenderLayers::OBJECTS, 255 },
+		{ RenderLayers::SPAWNS, 255 },
+		{ RenderLayers::PLAYER, 255 },
+		{ RenderLayers::UI, 255 },
+	};
+
+	//headless still decodes images, so loading costs the same, but there's nothing to show them on
+	if (isHeadless)
+	{
+		int imgFlags = IMG_INIT_PNG;
+		if (!(IMG_Init(imgFlags) & imgFlags))
+		{
+			printf("SDL_image could not initialize! SDL_image Error: %s\n", IMG_GetError());
+			return false;
+		}
+
+		return true;
+	}
+
 	//Initialize SDL
 	if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_JOYSTICK) < 0)
 	{
@@ -74,16 +100,6 @@ bool Display::Initialize()
 		}
 	}
 
-	//init layer opacities
-	Display::layerOpacity =
-	{
-		{ RenderLayers::GROUND, 255 },
-		{ RenderLayers::OBJECTS, 255 },
-		{ RenderLayers::SPAWNS, 255 },
-		{ RenderLayers::PLAYER, 255 },
-		{ RenderLayers::UI, 255 },
-	};
-
 	//set Render Scale
 	SDL_RenderSetScale(renderer, RENDER_SCALE_AMOUNT, RENDER_SCALE_AMOUNT);
 
@@ -126,6 +142,21 @@ bool Display::ShutDown()
 
 void Display::InjectFrame()
 {
+	Display::stats.frames++;
+	Display::stats.textures += static_cast<unsigned int>(Display::textureQueue.size());
+	Display::stats.tiles += static_cast<unsigned int>(Display::tileCommandQueue.size());
+	Display::stats.rectangles += static_cast<unsigned int>(Display::rectangleQueue.size());
+	Display::stats.texts += static_cast<unsigned int>(std::count_if(Display::textQueue.begin(), Display::textQueue.end(), [](const QueuedText& qt) { return qt.isVisible && !qt.text.empty(); }));
+
+	//nothing to draw on and no window to get events from, just drop this frame's queues
+	if (Display::isHeadless)
+	{
+		Display::textureQueue.clear();
+		Display::tileCommandQueue.clear();
+		Display::rectangleQueue.clear();
+		return;
+	}
+
 	//Handle events on queue
 	SDL_Event eventHandler;
 	while (SDL_PollEvent(&eventHandler) != 0)
@@ -151,7 +182,11 @@ void Display::InjectFrame()
 		Uint8 opacity = Display::GetRenderLayerOpacity(it->layer);
 		t->SetOpacity(opacity);
 
-		if (it->isSpriteSheet)
+		if (it->tileSourceRects)
+		{
+			t->DrawTiles(it->tileSourceRects, &Display::tileCommandQueue[it->firstTileCommand], it->tileCommandCount);
+		}
+		else if (it->isSpriteSheet)
 		{
 			SDL_Rect clip = { it->spriteSheetOffsetX, it->spriteSheetOffsetY, it->width, it->height };
 			t->Draw(it->x, it->y, it->shiftToCenterPoint, &clip);
@@ -163,6 +198,7 @@ void Display::InjectFrame()
 	}
 
 	Display::textureQueue.clear();
+	Display::tileCommandQueue.clear();
 
 	//create chatbox if one or more queued texts have requested it
 	auto it = std::find_if(textQueue.begin(), textQueue.end(), [](QueuedText& qt) { return qt.useChatBox; });
@@ -242,9 +278,35 @@ SDL_Renderer* const Display::GetRenderer()
 	return Display::renderer;
 }
 
+bool Display::IsRenderThread()
+{
+	return std::this_thread::get_id() == Display::renderThreadId;
+}
+
+bool Display::GetIsHeadless()
+{
+	return Display::isHeadless;
+}
+
+const DisplayStats& Display::GetStats()
+{
+	return Display::stats;
+}
+
 void Display::QueueTextureForRendering(const Texture* texture, int x, int y, int width, int height, bool shiftToCenterPoint, RenderLayers layer, bool isSpriteSheet /*=false*/, int spriteSheetOffsetX /*=0*/, int spriteSheetOffsetY /*=0*/)
 {
-	Display::textureQueue.push_back({ texture, x, y, width, height, shiftToCenterPoint, isSpriteSheet, spriteSheetOffsetX, spriteSheetOffsetY, layer });
+	Display::textureQueue.push_back({ texture, x, y, width, height, shiftToCenterPoint, isSpriteSheet, spriteSheetOffsetX, spriteSheetOffsetY, layer, nullptr, 0, 0 });
+}
+
+void Display::QueueTilesForRendering(const Texture* texture, const SDL_Rect* sourceRects, const TileDrawCommand* commands, int commandCount, RenderLayers layer)
+{
+	if (commandCount <= 0)
+		return;
+
+	//one queue entry for the whole batch, keeps its place in the draw order like any other texture
+	const int firstTileCommand = Display::tileCommandQueue.size();
+	Display::tileCommandQueue.insert(Display::tileCommandQueue.end(), commands, commands + commandCount);
+	Display::textureQueue.push_back({ texture, 0, 0, 0, 0, false, false, 0, 0, layer, sourceRects, firstTileCommand, commandCount });
 }
 
 void Display::QueueRectangleForRendering(int x, int y, int width, int height, unsigned char r, unsigned char g, unsigned char b, RenderLayers layer)
@@ -359,10 +421,14 @@ bool Display::loadFonts()
 
 SDL_Window* Display::window = nullptr;
 SDL_Renderer* Display::renderer = nullptr;
+bool Display::isHeadless = false;
+DisplayStats Display::stats = {};
+std::thread::id Display::renderThreadId;
 std::map<FontSize, TTF_Font*> Display::fonts;
 std::function<void(SDL_Event e)> Display::eventCallback;
 SDL_Joystick* Display::gameController = nullptr;
 std::vector<Display::QueuedTexture> Display::textureQueue;
+std::vector<TileDrawCommand> Display::tileCommandQueue;
 std::vector<Display::QueuedRectangle> Display::rectangleQueue;
 std::vector<Display::QueuedText> Display::textQueue;
 int Display::textControlIdCounter = 0;
@@ -4,6 +4,7 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <thread>
 #include "SDL_events.h"
 #include "SDL_ttf.h"
 
@@ -13,7 +14,8 @@ struct SDL_Renderer;
 class Texture;
 #pragma endregion
 
-enum RenderLayers
+//fixed underlying type so other headers can forward declare it
+enum RenderLayers : int
 {
 	GROUND = 0,
 	OBJECTS,
@@ -24,7 +26,15 @@ enum RenderLayers
 	NUM_LAYERS
 };
 
-enum FontSize
+//one map tile to draw: top left corner on screen and which of the tileset's source rects to copy from
+struct TileDrawCommand
+{
+	int x;
+	int y;
+	int sourceRectIndex;
+};
+
+enum FontSize : int
 {
 	TWELVE = 12,
 	SIXTEEN = 16,
@@ -34,18 +44,32 @@ enum FontSize
 	//remember to add corresponding load functionality when adding new font
 };
 
+//what was submitted for drawing, totals since Initialize()
+struct DisplayStats
+{
+	unsigned int frames;
+	unsigned int textures;		//a batch of map tiles counts as one, its tiles are counted separately
+	unsigned int tiles;
+	unsigned int rectangles;
+	unsigned int texts;			//visible ones, they're drawn every frame until removed
+};
+
 class Display
 {
 public:
 	Display() = delete;
 
-	static bool Initialize();
+	static bool Initialize(bool isHeadless = false);
 	static bool ShutDown();
 	static void InjectFrame();
 	static void SetEventCallback(std::function<void(SDL_Event e)> eventCallback);
 
 	static SDL_Renderer* const GetRenderer();
+	static bool IsRenderThread();
+	static bool GetIsHeadless();
+	static const DisplayStats& GetStats();
 	static void QueueTextureForRendering(const Texture* texture, int x, int y, int width, int height, bool shiftToCenterPoint, RenderLayers layer,  bool isSpriteSheet = false, int spriteSheetOffsetX = 0, int spriteSheetOffsetY = 0);
+	static void QueueTilesForRendering(const Texture* texture, const SDL_Rect* sourceRects, const TileDrawCommand* commands, int commandCount, RenderLayers layer);
 	static void QueueRectangleForRendering(int x, int y, int width, int height, unsigned char r, unsigned char g, unsigned char b, RenderLayers layer);
 
 	static TTF_Font* const GetFont(FontSize size);
@@ -76,6 +100,9 @@ private:
 
 	static SDL_Window* window;
 	static SDL_Renderer* renderer;
+	static bool isHeadless;		//no window or renderer, draws are counted and dropped
+	static DisplayStats stats;
+	static std::thread::id renderThreadId;		//the thread that called Initialize(), the only one allowed to touch the renderer
 	static std::map<FontSize, TTF_Font*> fonts;
 	static std::function<void(SDL_Event e)> eventCallback;
 	static SDL_Joystick* gameController;
@@ -95,8 +122,12 @@ private:
 		int spriteSheetOffsetX;
 		int spriteSheetOffsetY;
 		RenderLayers layer;
+		const SDL_Rect* tileSourceRects;	//only set for batches of map tiles, see tileCommandQueue
+		int firstTileCommand;
+		int tileCommandCount;
 	};
 	static std::vector<QueuedTexture> textureQueue;
+	static std::vector<TileDrawCommand> tileCommandQueue;		//flat storage for every queued tile batch this frame
 
 	struct QueuedRectangle
 	{
@@ -0,0 +1,787 @@
+#include "EntityStore.h"
+#include "Texture.h"
+#include "TextureCache.h"
+#include "Display.h"
+#include "Map.h"
+#include "FlowField.h"
+#include "TileCollider.h"
+#include "JobSystem.h"
+#include "Constants.h"
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+
+#ifndef _WIN32
+	//posix names for the msvc string functions the spawn and teleporter files are parsed with
+	#define _strdup strdup
+	#define strtok_s strtok_r
+#endif
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#define ENTITY_FLAG_ENEMY		0x01
+#define ENTITY_FLAG_DEAD		0x02
+
+#pragma region Constructor
+
+EntityStore::EntityStore(MapArena* arena)
+	: ids(arena), positionsX(arena), positionsY(arena), previousPositionsX(arena), previousPositionsY(arena), velocitiesX(arena), velocitiesY(arena), widths(arena), heights(arena),
+	spriteSheetOffsetsX(arena), spriteSheetOffsetsY(arena), hps(arena), idleMoveCooldowns(arena), flags(arena),
+	spawnPositionsX(arena), spawnPositionsY(arena), textureIndices(arena), randomStates(arena), simulationTiers(arena),
+	accumulatedTimes(arena), wakeTimers(arena), freeEnemySlots(arena), spatialHash(SPATIAL_HASH_CELL_SIZE)
+{
+	for (int behavior = 0; behavior <= NUM_BEHAVIORS; behavior++)
+	{
+		this->behaviorStarts[behavior] = 0;
+	}
+
+	for (int tier = 0; tier < NUM_SIMULATION_TIERS; tier++)
+	{
+		this->tierCounts[tier] = 0;
+	}
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+EntityStore::~EntityStore()
+{
+	for (Texture* texture : this->textures)
+	{
+		TextureCache::Release(texture);
+	}
+	this->textures.clear();
+	this->texturePaths.clear();
+}
+
+bool EntityStore::ReadDefinitionsFile(const std::string& filepath, std::vector<SpawnDefinition>& definitions)
+{
+	std::ifstream file(filepath.c_str());
+
+	if (!file.is_open())
+		return false;
+
+	std::string line;
+	while (std::getline(file, line))
+	{
+		if (line.length() < 2)
+			continue;
+
+		//skip comment lines
+		if (line[0] == '-' && line[1] == '-')
+			continue;
+
+		char* l = _strdup(line.c_str());
+
+		char* context = NULL;
+
+		char* idToken = strtok_s(l, ",", &context);
+		char* spawnXToken = strtok_s(NULL, ",", &context);
+		char* spawnYToken = strtok_s(NULL, ",", &context);
+		char* widthToken = strtok_s(NULL, ",", &context);
+		char* heightToken = strtok_s(NULL, ",", &context);
+		char* texturePathToken = strtok_s(NULL, ",", &context);
+		char* spriteOffsetXToken = strtok_s(NULL, ",", &context);
+		char* spriteOffsetYToken = strtok_s(NULL, ",", &context);
+		char* shouldIdleMoveToken = strtok_s(NULL, ",", &context);
+		char* isEnemyToken = strtok_s(NULL, ",", &context);
+
+		if ((idToken == NULL) ||
+			(spawnXToken == NULL) ||
+			(spawnYToken == NULL) ||
+			(widthToken == NULL) ||
+			(heightToken == NULL) ||
+			(texturePathToken == NULL) ||
+			(spriteOffsetXToken == NULL) ||
+			(spriteOffsetYToken == NULL) ||
+			(shouldIdleMoveToken == NULL) ||
+			(isEnemyToken == NULL))
+		{
+			free(l);
+			return false;
+		}
+
+		int id = atoi(idToken);
+		double spawnX = atof(spawnXToken);
+		double spawnY = atof(spawnYToken);
+		int width = atoi(widthToken);
+		int height = atoi(heightToken);
+		std::string texturePath = texturePathToken;
+		int spriteOffsetX = atoi(spriteOffsetXToken);
+		int spriteOffsetY = atoi(spriteOffsetYToken);
+
+		std::string shouldIdleMoveAsString(shouldIdleMoveToken);
+		//clear whitespace from shouldIdleMoveAsString
+		while (shouldIdleMoveAsString.size() && isspace(shouldIdleMoveAsString.front()))	//front
+			shouldIdleMoveAsString.erase(shouldIdleMoveAsString.begin());
+		while (shouldIdleMoveAsString.size() && isspace(shouldIdleMoveAsString.back()))	//back
+			shouldIdleMoveAsString.pop_back();
+		std::transform(shouldIdleMoveAsString.begin(), shouldIdleMoveAsString.end(), shouldIdleMoveAsString.begin(), ::tolower);
+		bool shouldIdleMove = shouldIdleMoveAsString.compare("true") == 0;
+
+		std::string isEnemyAsString(isEnemyToken);
+		//clear whitespace from isEnemyAsString
+		while (isEnemyAsString.size() && isspace(isEnemyAsString.front()))	//front
+			isEnemyAsString.erase(isEnemyAsString.begin());
+		while (isEnemyAsString.size() && isspace(isEnemyAsString.back()))	//back
+			isEnemyAsString.pop_back();
+		std::transform(isEnemyAsString.begin(), isEnemyAsString.end(), isEnemyAsString.begin(), ::tolower);
+		bool isEnemy = isEnemyAsString.compare("true") == 0;
+
+		//clear whitespace from texturePath
+		while (texturePath.size() && isspace(texturePath.front()))	//front
+			texturePath.erase(texturePath.begin());
+		while (texturePath.size() && isspace(texturePath.back()))	//back
+			texturePath.pop_back();
+
+		definitions.push_back({ id, spawnX, spawnY, width, height, texturePath, spriteOffsetX, spriteOffsetY, shouldIdleMove, isEnemy });
+
+		free(l);
+	}
+
+	file.close();
+
+	return true;
+}
+
+void EntityStore::Create(const std::vector<SpawnDefinition>& definitions)
+{
+#if _DEBUG
+	assert(this->ids.empty());	//only meant to be filled once, when the map loads
+#endif
+
+	//group by behaviour so Update() can run each kind over one contiguous range
+	std::vector<const SpawnDefinition*> sortedDefinitions[NUM_BEHAVIORS];
+	for (const SpawnDefinition& definition : definitions)
+	{
+		EntityBehavior behavior = STANDING;
+		if (definition.shouldIdleMove)
+			behavior = IDLE_WALKING;
+		else if (definition.isEnemy)
+			behavior = CHASING;
+
+		sortedDefinitions[behavior].push_back(&definition);
+	}
+
+	//one allocation per array out of the arena, with room for enemies spawned at runtime before anything has to grow
+	const size_t count = definitions.size() + ENTITY_RUNTIME_ENEMY_CAPACITY;
+	this->ids.reserve(count);
+	this->positionsX.reserve(count);
+	this->positionsY.reserve(count);
+	this->previousPositionsX.reserve(count);
+	this->previousPositionsY.reserve(count);
+	this->velocitiesX.reserve(count);
+	this->velocitiesY.reserve(count);
+	this->widths.reserve(count);
+	this->heights.reserve(count);
+	this->spriteSheetOffsetsX.reserve(count);
+	this->spriteSheetOffsetsY.reserve(count);
+	this->hps.reserve(count);
+	this->idleMoveCooldowns.reserve(count);
+	this->flags.reserve(count);
+	this->spawnPositionsX.reserve(count);
+	this->spawnPositionsY.reserve(count);
+	this->textureIndices.reserve(count);
+	this->randomStates.reserve(count);
+	this->simulationTiers.reserve(count);
+	this->accumulatedTimes.reserve(count);
+	this->wakeTimers.reserve(count);
+	this->freeEnemySlots.reserve(ENTITY_RUNTIME_ENEMY_CAPACITY);
+
+	for (int behavior = 0; behavior < NUM_BEHAVIORS; behavior++)
+	{
+		this->behaviorStarts[behavior] = static_cast<int>(this->ids.size());
+
+		for (const SpawnDefinition* definition : sortedDefinitions[behavior])
+		{
+			this->appendEntity(*definition);
+			this->spatialHash.Insert(this->GetCount() - 1, definition->spawnX, definition->spawnY, definition->width, definition->height);
+		}
+	}
+
+	this->behaviorStarts[NUM_BEHAVIORS] = this->GetCount();
+	this->definitionCount = this->GetCount();
+}
+
+bool EntityStore::UploadTextures()
+{
+	//render thread only, for stores created while loading a map in the background
+	for (Texture* texture : this->textures)
+	{
+		if (!texture->Upload())
+			return false;
+	}
+
+	return true;
+}
+
+int EntityStore::SpawnEnemy(const SpawnDefinition& definition)
+{
+#if _DEBUG
+	assert(definition.width);
+	assert(definition.height);
+#endif
+
+	//runtime spawns always chase, and chasers are the last range so new ones can go on the end without moving anyone
+	int index;
+	if (!this->freeEnemySlots.empty())
+	{
+		index = this->freeEnemySlots.back();
+		this->freeEnemySlots.pop_back();
+
+		this->ids[index] = definition.id;
+		this->positionsX[index] = definition.spawnX;
+		this->positionsY[index] = definition.spawnY;
+		this->previousPositionsX[index] = definition.spawnX;
+		this->previousPositionsY[index] = definition.spawnY;
+		this->velocitiesX[index] = 0.0;
+		this->velocitiesY[index] = 0.0;
+		this->widths[index] = definition.width;
+		this->heights[index] = definition.height;
+		this->spriteSheetOffsetsX[index] = definition.spriteSheetOffsetX;
+		this->spriteSheetOffsetsY[index] = definition.spriteSheetOffsetY;
+		this->idleMoveCooldowns[index] = 0;
+		this->spawnPositionsX[index] = definition.spawnX;
+		this->spawnPositionsY[index] = definition.spawnY;
+		this->textureIndices[index] = this->getTextureIndex(definition.texturePath);
+		this->randomStates[index] = index;
+		this->simulationTiers[index] = FULL_RATE;
+		this->accumulatedTimes[index] = 0;
+	}
+	else
+	{
+		index = this->GetCount();
+		this->appendEntity(definition);
+		this->behaviorStarts[NUM_BEHAVIORS] = this->GetCount();
+	}
+
+	this->hps[index] = ENEMY_HP;
+	this->flags[index] = ENTITY_FLAG_ENEMY;
+	this->spatialHash.Insert(index, definition.spawnX, definition.spawnY, definition.width, definition.height);
+
+	//whatever spawned it probably wants it doing something, even out of view
+	this->Wake(index);
+
+	return index;
+}
+
+void EntityStore::Kill(int index)
+{
+#if _DEBUG
+	assert(this->GetIsAlive(index));
+#endif
+
+	//dead entities stay in their slot, skipped by updates, drawing and (once out of the spatial hash) collision
+	this->flags[index] |= ENTITY_FLAG_DEAD;
+	this->spatialHash.Remove(index);
+
+	//spawns file entities wait for Reset() to bring them back, runtime spawns hand their slot to the next one
+	if (index >= this->definitionCount)
+		this->freeEnemySlots.push_back(index);
+}
+
+void EntityStore::Update(const Map* map, const FlowField* flowField, double targetX, double targetY, const SDL_Rect& camera, unsigned int previousFrameTime, JobSystem* jobSystem)
+{
+	for (int tier = 0; tier < NUM_SIMULATION_TIERS; tier++)
+	{
+		this->tierCounts[tier] = 0;
+	}
+
+	//standing entities have nothing to update
+	this->updateBehavior(IDLE_WALKING, jobSystem, [this, map, &camera, previousFrameTime](int first, int last, ChunkUpdate& chunkUpdate)
+	{
+		this->updateIdleWalkers(first, last, map, camera, previousFrameTime, chunkUpdate);
+	});
+
+	this->updateBehavior(CHASING, jobSystem, [this, map, flowField, targetX, targetY, &camera, previousFrameTime](int first, int last, ChunkUpdate& chunkUpdate)
+	{
+		this->updateChasers(first, last, map, flowField, targetX, targetY, camera, previousFrameTime, chunkUpdate);
+	});
+}
+
+void EntityStore::Draw(const SDL_Rect& camera, double interpolation, JobSystem* jobSystem) const
+{
+	//cull on the workers, but queue from this thread in entity order so draw order doesn't depend on who culled what
+	const int chunkCount = JobSystem::GetChunkCount(this->GetCount(), ENTITY_JOB_GRAIN_SIZE);
+	if (static_cast<int>(this->visibleEntitiesByChunk.size()) < chunkCount)
+	{
+		this->visibleEntitiesByChunk.resize(chunkCount);
+	}
+
+	jobSystem->ParallelFor(this->GetCount(), ENTITY_JOB_GRAIN_SIZE, [this, &camera, interpolation](int first, int last, int chunkIndex, int)
+	{
+		std::vector<int>& visibleEntities = this->visibleEntitiesByChunk[chunkIndex];
+		visibleEntities.clear();
+
+		for (int i = first; i < last; i++)
+		{
+			if (this->flags[i] & ENTITY_FLAG_DEAD)
+				continue;
+
+			const int halfWidth = this->widths[i] / 2;
+			const int halfHeight = this->heights[i] / 2;
+			const double x = this->getInterpolatedPositionX(i, interpolation);
+			const double y = this->getInterpolatedPositionY(i, interpolation);
+
+			//don't bother queueing entities the camera can't see, positions are centre points and the camera is its top left corner
+			if (x + halfWidth < camera.x - DRAW_CULLING_MARGIN || x - halfWidth > camera.x + CAMERA_VIEW_WIDTH + DRAW_CULLING_MARGIN)
+				continue;
+
+			if (y + halfHeight < camera.y - DRAW_CULLING_MARGIN || y - halfHeight > camera.y + CAMERA_VIEW_HEIGHT + DRAW_CULLING_MARGIN)
+				continue;
+
+			visibleEntities.push_back(i);
+		}
+	});
+
+	for (int chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+	{
+		for (int i : this->visibleEntitiesByChunk[chunkIndex])
+		{
+			const int halfWidth = this->widths[i] / 2;
+			const int halfHeight = this->heights[i] / 2;
+
+			//textures are shared between entities of different sizes, so shift to the top left corner here instead of through the texture's render offset
+			const int screenX = static_cast<int>(this->getInterpolatedPositionX(i, interpolation) - camera.x) - halfWidth;
+			const int screenY = static_cast<int>(this->getInterpolatedPositionY(i, interpolation) - camera.y) - halfHeight;
+
+			Display::QueueTextureForRendering(this->textures[this->textureIndices[i]], screenX, screenY, this->widths[i], this->heights[i], false, RenderLayers::SPAWNS, true, this->spriteSheetOffsetsX[i], this->spriteSheetOffsetsY[i]);
+		}
+	}
+}
+
+void EntityStore::Reset()
+{
+	//back to how Create() left everything, without rereading the spawns file
+	this->freeEnemySlots.clear();
+	for (int i = this->GetCount() - 1; i >= this->definitionCount; i--)
+	{
+		//runtime spawns are gone, highest slot first so the lowest gets reused first
+		if (this->GetIsAlive(i))
+		{
+			this->flags[i] |= ENTITY_FLAG_DEAD;
+			this->spatialHash.Remove(i);
+		}
+
+		this->freeEnemySlots.push_back(i);
+	}
+
+	for (int i = 0; i < this->definitionCount; i++)
+	{
+		const bool wasDead = !this->GetIsAlive(i);
+		this->flags[i] &= ~ENTITY_FLAG_DEAD;
+
+		this->positionsX[i] = this->spawnPositionsX[i];
+		this->positionsY[i] = this->spawnPositionsY[i];
+		this->previousPositionsX[i] = this->spawnPositionsX[i];
+		this->previousPositionsY[i] = this->spawnPositionsY[i];
+		this->velocitiesX[i] = 0.0;
+		this->velocitiesY[i] = 0.0;
+		this->idleMoveCooldowns[i] = 0;
+		this->hps[i] = (this->flags[i] & ENTITY_FLAG_ENEMY) ? ENEMY_HP : 0;
+		this->randomStates[i] = i;
+		this->simulationTiers[i] = FULL_RATE;
+		this->accumulatedTimes[i] = (i * 37) % SIMULATION_REDUCED_RATE_INTERVAL;
+		this->wakeTimers[i] = 0;
+
+		if (wasDead)
+			this->spatialHash.Insert(i, this->positionsX[i], this->positionsY[i], this->widths[i], this->heights[i]);
+		else
+			this->spatialHash.Update(i, this->positionsX[i], this->positionsY[i], this->widths[i], this->heights[i]);
+	}
+}
+
+int EntityStore::GetCount() const
+{
+	return static_cast<int>(this->ids.size());
+}
+
+int EntityStore::GetID(int index) const
+{
+	return this->ids[index];
+}
+
+EntityBehavior EntityStore::GetBehavior(int index) const
+{
+	for (int behavior = 0; behavior < NUM_BEHAVIORS; behavior++)
+	{
+		if (index < this->behaviorStarts[behavior + 1])
+			return static_cast<EntityBehavior>(behavior);
+	}
+
+#if _DEBUG
+	assert(false);	//index out of range
+#endif
+
+	return STANDING;
+}
+
+bool EntityStore::GetIsEnemy(int index) const
+{
+	return (this->flags[index] & ENTITY_FLAG_ENEMY) != 0;
+}
+
+bool EntityStore::GetIsAlive(int index) const
+{
+	return (this->flags[index] & ENTITY_FLAG_DEAD) == 0;
+}
+
+double EntityStore::GetPositionX(int index) const
+{
+	return this->positionsX[index];
+}
+
+double EntityStore::GetPositionY(int index) const
+{
+	return this->positionsY[index];
+}
+
+int EntityStore::GetWidth(int index) const
+{
+	return this->widths[index];
+}
+
+int EntityStore::GetHeight(int index) const
+{
+	return this->heights[index];
+}
+
+int EntityStore::GetHP(int index) const
+{
+	return this->hps[index];
+}
+
+int EntityStore::GetFreeEnemySlotCount() const
+{
+	return static_cast<int>(this->freeEnemySlots.size());
+}
+
+SimulationTier EntityStore::GetSimulationTier(int index) const
+{
+	return static_cast<SimulationTier>(this->simulationTiers[index]);
+}
+
+int EntityStore::GetSimulationTierCount(SimulationTier tier) const
+{
+#if _DEBUG
+	assert(tier >= 0 && tier < NUM_SIMULATION_TIERS);
+#endif
+
+	return this->tierCounts[tier];
+}
+
+void EntityStore::Wake(int index)
+{
+	//full rate from the next Update() on, however far away it is
+	this->wakeTimers[index] = SIMULATION_WAKE_DURATION;
+}
+
+void EntityStore::OnHitByPlayerAttack(int index)
+{
+#if _DEBUG
+	assert(this->GetIsEnemy(index));
+#endif
+
+	this->hps[index]--;
+	this->Wake(index);
+
+	if (this->hps[index] <= 0)
+		this->Kill(index);
+}
+
+void EntityStore::DoRecoil(int index, const Map* map, Direction attackerIsFacing)
+{
+	//bounce back to show recoil, but not into (or through) a wall
+	double deltaX = 0.0;
+	double deltaY = 0.0;
+
+	switch (attackerIsFacing)
+	{
+	case Direction::UP:		deltaY = -ATTACK_RECOIL_AMOUNT;	break;
+	case Direction::DOWN:	deltaY = ATTACK_RECOIL_AMOUNT;	break;
+	case Direction::LEFT:	deltaX = -ATTACK_RECOIL_AMOUNT;	break;
+	case Direction::RIGHT:	deltaX = ATTACK_RECOIL_AMOUNT;	break;
+
+	default:
+#if _DEBUG
+		assert(false);	//wtf direction?
+#endif
+		break;
+	}
+
+	TileCollider::Move(map, this->positionsX[index], this->positionsY[index], this->widths[index], this->heights[index], deltaX, deltaY);
+	this->spatialHash.Update(index, this->positionsX[index], this->positionsY[index], this->widths[index], this->heights[index]);
+}
+
+const SpatialHash& EntityStore::GetSpatialHash() const
+{
+	return this->spatialHash;
+}
+
+size_t EntityStore::GetByteCount() const
+{
+	size_t byteCount = this->ids.size() * (sizeof(int) * 9 + sizeof(unsigned int) * 2 + sizeof(double) * 8 + sizeof(unsigned char) * 2);
+
+	for (const Texture* texture : this->textures)
+	{
+		byteCount += sizeof(Texture) + texture->GetByteCount();
+	}
+
+	return byteCount;
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+void EntityStore::updateIdleWalkers(int first, int last, const Map* map, const SDL_Rect& camera, unsigned int previousFrameTime, ChunkUpdate& chunkUpdate)
+{
+	for (int i = first; i < last; i++)
+	{
+		if (this->flags[i] & ENTITY_FLAG_DEAD)
+			continue;
+
+		this->previousPositionsX[i] = this->positionsX[i];
+		this->previousPositionsY[i] = this->positionsY[i];
+
+		const unsigned int simulatedTime = this->advanceSimulation(i, camera, previousFrameTime, chunkUpdate);
+		if (simulatedTime == 0)
+			continue;
+
+		if (this->idleMoveCooldowns[i] <= 0)
+		{
+			//pick a new direction (or none) and stick with it for a while
+			switch (EntityStore::nextRandom(this->randomStates[i]) % 5)
+			{
+			case 0: this->velocitiesX[i] = 0.0;				this->velocitiesY[i] = 0.0;				break;
+			case 1: this->velocitiesX[i] = 0.0;				this->velocitiesY[i] = -NPC_VELOCITY;	break;
+			case 2: this->velocitiesX[i] = 0.0;				this->velocitiesY[i] = NPC_VELOCITY;	break;
+			case 3: this->velocitiesX[i] = -NPC_VELOCITY;	this->velocitiesY[i] = 0.0;				break;
+			case 4: this->velocitiesX[i] = NPC_VELOCITY;	this->velocitiesY[i] = 0.0;				break;
+			}
+
+			this->idleMoveCooldowns[i] = NPC_IDLEMOVEMENT_COOLDOWN;
+			continue;
+		}
+
+		this->idleMoveCooldowns[i] -= simulatedTime;
+
+		if (this->velocitiesX[i] == 0.0 && this->velocitiesY[i] == 0.0)
+			continue;
+
+		//stop at (and slide along) tiles that aren't walkable and the edges of the map, the collider sweeps so a long reduced rate step can't tunnel
+		const double simulatedTimeInSeconds = simulatedTime / 1000.0;
+		TileCollider::Move(map, this->positionsX[i], this->positionsY[i], this->widths[i], this->heights[i], this->velocitiesX[i] * simulatedTimeInSeconds, this->velocitiesY[i] * simulatedTimeInSeconds);
+		chunkUpdate.movedEntities.push_back(i);
+	}
+}
+
+void EntityStore::updateChasers(int first, int last, const Map* map, const FlowField* flowField, double targetX, double targetY, const SDL_Rect& camera, unsigned int previousFrameTime, ChunkUpdate& chunkUpdate)
+{
+	for (int i = first; i < last; i++)
+	{
+		if (this->flags[i] & ENTITY_FLAG_DEAD)
+			continue;
+
+		this->previousPositionsX[i] = this->positionsX[i];
+		this->previousPositionsY[i] = this->positionsY[i];
+
+		const unsigned int simulatedTime = this->advanceSimulation(i, camera, previousFrameTime, chunkUpdate);
+		if (simulatedTime == 0)
+			continue;
+
+		const double movementVelocity = ENEMY_VELOCITY * (simulatedTime / 1000.0);
+
+		double stepTargetX = targetX;
+		double stepTargetY = targetY;
+
+		//follow the flow field towards the centre of the next tile on the way to the target, tile (row, column) is centred on (column * TILE_WIDTH, row * TILE_HEIGHT)
+		//off the field (too far away, or already on the target's tile) we just head straight for it
+		const int tileRow = Map::GetTileAt(this->positionsY[i], TILE_HEIGHT);
+		const int tileColumn = Map::GetTileAt(this->positionsX[i], TILE_WIDTH);
+
+		switch (flowField->GetDirection(tileRow, tileColumn))
+		{
+		case Direction::UP:		stepTargetX = tileColumn * TILE_WIDTH;			stepTargetY = (tileRow - 1) * TILE_HEIGHT;	break;
+		case Direction::DOWN:	stepTargetX = tileColumn * TILE_WIDTH;			stepTargetY = (tileRow + 1) * TILE_HEIGHT;	break;
+		case Direction::LEFT:	stepTargetX = (tileColumn - 1) * TILE_WIDTH;	stepTargetY = tileRow * TILE_HEIGHT;		break;
+		case Direction::RIGHT:	stepTargetX = (tileColumn + 1) * TILE_WIDTH;	stepTargetY = tileRow * TILE_HEIGHT;		break;
+		default:
+			break;
+		}
+
+		//never overshoot the target, or we'd jitter around tile centres
+		const double deltaX = std::max(-movementVelocity, std::min(movementVelocity, stepTargetX - this->positionsX[i]));
+		const double deltaY = std::max(-movementVelocity, std::min(movementVelocity, stepTargetY - this->positionsY[i]));
+
+		TileCollider::Move(map, this->positionsX[i], this->positionsY[i], this->widths[i], this->heights[i], deltaX, deltaY);
+		chunkUpdate.movedEntities.push_back(i);
+	}
+}
+
+void EntityStore::updateBehavior(EntityBehavior behavior, JobSystem* jobSystem, const std::function<void(int first, int last, ChunkUpdate& chunkUpdate)>& update)
+{
+	const int first = this->behaviorStarts[behavior];
+	const int count = this->behaviorStarts[behavior + 1] - first;
+
+	const int chunkCount = JobSystem::GetChunkCount(count, ENTITY_JOB_GRAIN_SIZE);
+	if (static_cast<int>(this->chunkUpdates.size()) < chunkCount)
+	{
+		this->chunkUpdates.resize(chunkCount);
+	}
+
+	//each entity only touches its own fields (and reads the map), so chunks can run on any worker in any order
+	jobSystem->ParallelFor(count, ENTITY_JOB_GRAIN_SIZE, [this, first, &update](int chunkFirst, int chunkLast, int chunkIndex, int)
+	{
+		ChunkUpdate& chunkUpdate = this->chunkUpdates[chunkIndex];
+		chunkUpdate.movedEntities.clear();
+		for (int tier = 0; tier < NUM_SIMULATION_TIERS; tier++)
+		{
+			chunkUpdate.tierCounts[tier] = 0;
+		}
+
+		update(first + chunkFirst, first + chunkLast, chunkUpdate);
+	});
+
+	//the spatial hash isn't thread safe, catch it up here in entity order
+	for (int chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+	{
+		const ChunkUpdate& chunkUpdate = this->chunkUpdates[chunkIndex];
+
+		for (int i : chunkUpdate.movedEntities)
+		{
+			this->spatialHash.Update(i, this->positionsX[i], this->positionsY[i], this->widths[i], this->heights[i]);
+		}
+
+		for (int tier = 0; tier < NUM_SIMULATION_TIERS; tier++)
+		{
+			this->tierCounts[tier] += chunkUpdate.tierCounts[tier];
+		}
+	}
+}
+
+unsigned int EntityStore::advanceSimulation(int index, const SDL_Rect& camera, unsigned int previousFrameTime, ChunkUpdate& chunkUpdate)
+{
+	//picks the entity's tier for this frame and returns how many milliseconds it should advance by, 0 to skip it
+	const int halfWidth = this->widths[index] / 2;
+	const int halfHeight = this->heights[index] / 2;
+
+	//how far the entity's box is outside the camera view on whichever axis it's further out on, 0 if it's in view
+	const double distanceX = std::max(std::max(camera.x - (this->positionsX[index] + halfWidth), (this->positionsX[index] - halfWidth) - (camera.x + CAMERA_VIEW_WIDTH)), 0.0);
+	const double distanceY = std::max(std::max(camera.y - (this->positionsY[index] + halfHeight), (this->positionsY[index] - halfHeight) - (camera.y + CAMERA_VIEW_HEIGHT)), 0.0);
+	const double distance = std::max(distanceX, distanceY);
+
+	SimulationTier tier = DORMANT;
+	if (distance <= SIMULATION_FULL_RATE_MARGIN || this->wakeTimers[index] > 0)
+		tier = FULL_RATE;
+	else if (distance <= SIMULATION_REDUCED_RATE_MARGIN)
+		tier = REDUCED_RATE;
+
+	if (this->wakeTimers[index] > 0)
+		this->wakeTimers[index] -= previousFrameTime;
+
+	this->simulationTiers[index] = static_cast<unsigned char>(tier);
+	chunkUpdate.tierCounts[tier]++;
+
+	unsigned int simulatedTime = 0;
+	switch (tier)
+	{
+	case FULL_RATE:
+		//coming in from reduced rate, catch up on whatever it hadn't been given yet
+		simulatedTime = this->accumulatedTimes[index] + previousFrameTime;
+		this->accumulatedTimes[index] = 0;
+		break;
+
+	case REDUCED_RATE:
+		this->accumulatedTimes[index] += previousFrameTime;
+		if (this->accumulatedTimes[index] >= SIMULATION_REDUCED_RATE_INTERVAL)
+		{
+			simulatedTime = this->accumulatedTimes[index];
+			this->accumulatedTimes[index] = 0;
+		}
+		break;
+
+	default:
+		//frozen, time spent dormant is simply lost rather than all played out at once when it wakes
+		this->accumulatedTimes[index] = 0;
+		break;
+	}
+
+	return simulatedTime;
+}
+
+void EntityStore::appendEntity(const SpawnDefinition& definition)
+{
+#if _DEBUG
+	assert(definition.width);
+	assert(definition.height);
+#endif
+
+	this->ids.push_back(definition.id);
+	this->positionsX.push_back(definition.spawnX);
+	this->positionsY.push_back(definition.spawnY);
+	this->previousPositionsX.push_back(definition.spawnX);
+	this->previousPositionsY.push_back(definition.spawnY);
+	this->velocitiesX.push_back(0.0);
+	this->velocitiesY.push_back(0.0);
+	this->widths.push_back(definition.width);
+	this->heights.push_back(definition.height);
+	this->spriteSheetOffsetsX.push_back(definition.spriteSheetOffsetX);
+	this->spriteSheetOffsetsY.push_back(definition.spriteSheetOffsetY);
+	this->hps.push_back(definition.isEnemy ? ENEMY_HP : 0);
+	this->idleMoveCooldowns.push_back(0);
+	this->flags.push_back(definition.isEnemy ? ENTITY_FLAG_ENEMY : 0);
+	this->spawnPositionsX.push_back(definition.spawnX);
+	this->spawnPositionsY.push_back(definition.spawnY);
+	this->textureIndices.push_back(this->getTextureIndex(definition.texturePath));
+	this->randomStates.push_back(static_cast<unsigned int>(this->ids.size()) - 1);
+	this->simulationTiers.push_back(FULL_RATE);
+	this->accumulatedTimes.push_back(((this->ids.size() - 1) * 37) % SIMULATION_REDUCED_RATE_INTERVAL);	//staggered, so reduced rate entities don't all update on the same frame
+	this->wakeTimers.push_back(0);
+}
+
+int EntityStore::getTextureIndex(const std::string& texturePath)
+{
+	for (size_t i = 0; i < this->texturePaths.size(); i++)
+	{
+		if (this->texturePaths[i] == texturePath)
+			return static_cast<int>(i);
+	}
+
+	//shared with every other map using the same sprite sheet, uploads right away if we're on the render thread (otherwise UploadTextures() does that later)
+	Texture* texture = TextureCache::Acquire(texturePath);
+
+#if _DEBUG
+	assert(texture);
+#endif
+
+	this->textures.push_back(texture);
+	this->texturePaths.push_back(texturePath);
+
+	return static_cast<int>(this->textures.size()) - 1;
+}
+
+double EntityStore::getInterpolatedPositionX(int index, double interpolation) const
+{
+	return this->previousPositionsX[index] + ((this->positionsX[index] - this->previousPositionsX[index]) * interpolation);
+}
+
+double EntityStore::getInterpolatedPositionY(int index, double interpolation) const
+{
+	return this->previousPositionsY[index] + ((this->positionsY[index] - this->previousPositionsY[index]) * interpolation);
+}
+
+unsigned int EntityStore::nextRandom(unsigned int& state)
+{
+	//small hash based generator, any state (even 0) is a fine seed
+	state += 0x9E3779B9u;
+	unsigned int z = state;
+	z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+	z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+	return z ^ (z >> 16);
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Object.h"
+#include "SpatialHash.h"
+#include "MapArena.h"
+#include <string>
+#include <vector>
+#include <functional>
+
+#pragma region Forward Declarations
+class Texture;
+class Map;
+class FlowField;
+class JobSystem;
+struct SDL_Rect;
+#pragma endregion
+
+//one entry of a map's _spawns.txt, kept separate from EntityStore so it can be read without creating textures
+struct SpawnDefinition
+{
+	int id;
+	double spawnX;
+	double spawnY;
+	int width;
+	int height;
+	std::string texturePath;
+	int spriteSheetOffsetX;
+	int spriteSheetOffsetY;
+	bool shouldIdleMove;
+	bool isEnemy;
+};
+
+//what an entity does each frame, entities are stored grouped in this order
+enum EntityBehavior
+{
+	STANDING = 0,	//never moves on its own
+	IDLE_WALKING,	//wanders about at random
+	CHASING,		//follows the flow field to the player
+
+	NUM_BEHAVIORS
+};
+
+//how often an entity that moves on its own gets updated, by how far it is from what the camera can see
+enum SimulationTier
+{
+	FULL_RATE = 0,	//in view or close to it (or recently woken), updated every frame
+	REDUCED_RATE,	//further out, updated every SIMULATION_REDUCED_RATE_INTERVAL with all the time that passed since
+	DORMANT,		//far away, frozen until the camera gets close or something wakes it
+
+	NUM_SIMULATION_TIERS
+};
+
+//every spawn and enemy on a map, one array per field so each behaviour updates in one tight loop over its own range
+//the arrays live in the map's arena, enemies that die leave their slot on a free list for the next one spawned at runtime
+class EntityStore
+{
+public:
+	EntityStore(MapArena* arena);
+	~EntityStore();
+
+	static bool ReadDefinitionsFile(const std::string& filepath, std::vector<SpawnDefinition>& definitions);
+
+	void Create(const std::vector<SpawnDefinition>& definitions);
+	bool UploadTextures();
+
+	int SpawnEnemy(const SpawnDefinition& definition);
+	void Kill(int index);
+
+	void Update(const Map* map, const FlowField* flowField, double targetX, double targetY, const SDL_Rect& camera, unsigned int previousFrameTime, JobSystem* jobSystem);
+	void Draw(const SDL_Rect& camera, double interpolation, JobSystem* jobSystem) const;
+	void Reset();
+
+	int GetCount() const;
+	int GetID(int index) const;
+	EntityBehavior GetBehavior(int index) const;
+	bool GetIsEnemy(int index) const;
+	bool GetIsAlive(int index) const;
+	double GetPositionX(int index) const;
+	double GetPositionY(int index) const;
+	int GetWidth(int index) const;
+	int GetHeight(int index) const;
+	int GetHP(int index) const;
+	int GetFreeEnemySlotCount() const;
+	SimulationTier GetSimulationTier(int index) const;
+	int GetSimulationTierCount(SimulationTier tier) const;
+
+	void Wake(int index);
+	void OnHitByPlayerAttack(int index);
+	void DoRecoil(int index, const Map* map, Direction attackerIsFacing);
+
+	const SpatialHash& GetSpatialHash() const;
+
+	size_t GetByteCount() const;
+
+private:
+	//what one ParallelFor chunk of an update produced, filled by whichever worker ran it and merged back in chunk order on the calling thread
+	struct ChunkUpdate
+	{
+		std::vector<int> movedEntities;
+		int tierCounts[NUM_SIMULATION_TIERS];
+	};
+
+	void updateIdleWalkers(int first, int last, const Map* map, const SDL_Rect& camera, unsigned int previousFrameTime, ChunkUpdate& chunkUpdate);
+	void updateChasers(int first, int last, const Map* map, const FlowField* flowField, double targetX, double targetY, const SDL_Rect& camera, unsigned int previousFrameTime, ChunkUpdate& chunkUpdate);
+	void updateBehavior(EntityBehavior behavior, JobSystem* jobSystem, const std::function<void(int first, int last, ChunkUpdate& chunkUpdate)>& update);
+	unsigned int advanceSimulation(int index, const SDL_Rect& camera, unsigned int previousFrameTime, ChunkUpdate& chunkUpdate);
+	void appendEntity(const SpawnDefinition& definition);
+	int getTextureIndex(const std::string& texturePath);
+	double getInterpolatedPositionX(int index, double interpolation) const;
+	double getInterpolatedPositionY(int index, double interpolation) const;
+
+	static unsigned int nextRandom(unsigned int& state);
+
+	int behaviorStarts[NUM_BEHAVIORS + 1];		//entities [behaviorStarts[b], behaviorStarts[b + 1]) all have behaviour b
+
+	int definitionCount = 0;				//entities from the spawns file, anything after them was spawned at runtime
+
+	//indexed by entity
+	ArenaVector<int> ids;
+	ArenaVector<double> positionsX;			//centre of the entity, like Object
+	ArenaVector<double> positionsY;
+	ArenaVector<double> previousPositionsX;	//as of the start of the last Update(), Draw() blends from here to positionsX/Y
+	ArenaVector<double> previousPositionsY;
+	ArenaVector<double> velocitiesX;		//only used by idle walkers, chasers work theirs out every frame
+	ArenaVector<double> velocitiesY;
+	ArenaVector<int> widths;
+	ArenaVector<int> heights;
+	ArenaVector<int> spriteSheetOffsetsX;
+	ArenaVector<int> spriteSheetOffsetsY;
+	ArenaVector<int> hps;
+	ArenaVector<int> idleMoveCooldowns;
+	ArenaVector<unsigned char> flags;		//ENTITY_FLAG_*
+	ArenaVector<double> spawnPositionsX;	//where Reset() puts them back
+	ArenaVector<double> spawnPositionsY;
+	ArenaVector<int> textureIndices;
+	ArenaVector<unsigned int> randomStates;	//per entity rather than rand(), so updates can run on any worker and still play out the same every time
+	ArenaVector<unsigned char> simulationTiers;
+	ArenaVector<unsigned int> accumulatedTimes;	//in milliseconds, how long a reduced rate entity has gone without an update
+	ArenaVector<int> wakeTimers;			//in milliseconds, kept at full rate until this runs out whatever the distance
+
+	ArenaVector<int> freeEnemySlots;		//dead chasers whose slot SpawnEnemy() can reuse without growing the arrays
+
+	SpatialHash spatialHash;				//ids are entity indices, kept up to date whenever something moves
+
+	int tierCounts[NUM_SIMULATION_TIERS];	//as of the last Update(), standing and dead entities never update so they aren't counted
+
+	//one entry per ParallelFor chunk
+	std::vector<ChunkUpdate> chunkUpdates;
+	mutable std::vector<std::vector<int>> visibleEntitiesByChunk;
+
+	//one texture per sprite sheet, shared by every entity using it
+	std::vector<Texture*> textures;
+	std::vector<std::string> texturePaths;
+};
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include "FlowField.h"
+#include "Map.h"
+#include <climits>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Constructor
+
+FlowField::FlowField(int radius)
+	: radius(radius), windowSize((radius * 2) + 1)
+{
+#if _DEBUG
+	assert(radius > 0);
+#endif
+
+	const int cellCount = this->windowSize * this->windowSize;
+	this->cellGenerations.resize(cellCount, 0);
+	this->distances.resize(cellCount, 0);
+	this->directions.resize(cellCount, Direction::NONE);
+	this->frontier.reserve(cellCount);
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+bool FlowField::Update(const Map* map, int targetRow, int targetColumn)
+{
+	//nothing to do until the target crosses into another tile
+	if (this->isValid && map == this->map && targetRow == this->targetRow && targetColumn == this->targetColumn)
+		return false;
+
+	this->map = map;
+	this->targetRow = targetRow;
+	this->targetColumn = targetColumn;
+	this->originRow = targetRow - this->radius;
+	this->originColumn = targetColumn - this->radius;
+
+	this->rebuild();
+
+	this->isValid = true;
+
+	return true;
+}
+
+void FlowField::Invalidate()
+{
+	//for map switches and tile edits, the next Update() rebuilds even if the target hasn't moved
+	this->isValid = false;
+}
+
+Direction FlowField::GetDirection(int row, int column) const
+{
+	const int index = this->getCellIndex(row, column);
+	if (index < 0)
+		return Direction::NONE;
+
+	return static_cast<Direction>(this->directions[index]);
+}
+
+int FlowField::GetDistance(int row, int column) const
+{
+	//in tiles, -1 if the target can't be reached from here within the radius
+	const int index = this->getCellIndex(row, column);
+	if (index < 0)
+		return -1;
+
+	return this->distances[index];
+}
+
+int FlowField::GetRadius() const
+{
+	return this->radius;
+}
+
+int FlowField::GetTargetRow() const
+{
+	return this->targetRow;
+}
+
+int FlowField::GetTargetColumn() const
+{
+	return this->targetColumn;
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+void FlowField::rebuild()
+{
+	this->generation++;
+	this->frontier.clear();
+
+	if (!this->map)
+		return;
+
+	const int targetIndex = ((this->targetRow - this->originRow) * this->windowSize) + (this->targetColumn - this->originColumn);
+	this->cellGenerations[targetIndex] = this->generation;
+	this->distances[targetIndex] = 0;
+	this->directions[targetIndex] = Direction::NONE;
+	this->frontier.push_back(targetIndex);
+
+	//every step costs the same, so a breadth first fill gives the same distances as dijkstra
+	//for each neighbour: row and column offset, and the direction that leads back from it to the cell we came from
+	static const int neighbourOffsets[4][3] =
+	{
+		{ -1, 0, Direction::DOWN },
+		{ 1, 0, Direction::UP },
+		{ 0, -1, Direction::RIGHT },
+		{ 0, 1, Direction::LEFT },
+	};
+
+	for (size_t next = 0; next < this->frontier.size(); next++)
+	{
+		const int index = this->frontier[next];
+		const int windowRow = index / this->windowSize;
+		const int windowColumn = index % this->windowSize;
+		const unsigned short distance = this->distances[index] + 1;
+
+		for (const int* offset : neighbourOffsets)
+		{
+			const int neighbourWindowRow = windowRow + offset[0];
+			const int neighbourWindowColumn = windowColumn + offset[1];
+
+			if (neighbourWindowRow < 0 || neighbourWindowRow >= this->windowSize || neighbourWindowColumn < 0 || neighbourWindowColumn >= this->windowSize)
+				continue;
+
+			const int neighbourIndex = (neighbourWindowRow * this->windowSize) + neighbourWindowColumn;
+			if (this->cellGenerations[neighbourIndex] == this->generation)
+				continue;
+
+			//mark blocked cells visited too, so each one is only looked up once
+			this->cellGenerations[neighbourIndex] = this->generation;
+
+			if (!this->map->IsWalkable(this->originRow + neighbourWindowRow, this->originColumn + neighbourWindowColumn))
+			{
+				this->distances[neighbourIndex] = USHRT_MAX;
+				this->directions[neighbourIndex] = Direction::NONE;
+				continue;
+			}
+
+			this->distances[neighbourIndex] = distance;
+			this->directions[neighbourIndex] = static_cast<signed char>(offset[2]);
+			this->frontier.push_back(neighbourIndex);
+		}
+	}
+}
+
+int FlowField::getCellIndex(int row, int column) const
+{
+	//-1 for cells outside the window, blocked or not reached this time round
+	const int windowRow = row - this->originRow;
+	const int windowColumn = column - this->originColumn;
+
+	if (!this->isValid || windowRow < 0 || windowRow >= this->windowSize || windowColumn < 0 || windowColumn >= this->windowSize)
+		return -1;
+
+	const int index = (windowRow * this->windowSize) + windowColumn;
+	if (this->cellGenerations[index] != this->generation || this->distances[index] == USHRT_MAX)
+		return -1;
+
+	return index;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Object.h"
+#include <vector>
+
+#pragma region Forward Declarations
+class Map;
+#pragma endregion
+
+//distance map over the walkable tiles around a target, shared by everything chasing it
+//only rebuilt when the target changes tile, and only within radius tiles of it
+class FlowField
+{
+public:
+	FlowField(int radius);
+
+	bool Update(const Map* map, int targetRow, int targetColumn);
+	void Invalidate();
+
+	Direction GetDirection(int row, int column) const;
+	int GetDistance(int row, int column) const;
+
+	int GetRadius() const;
+	int GetTargetRow() const;
+	int GetTargetColumn() const;
+
+private:
+	void rebuild();
+	int getCellIndex(int row, int column) const;
+
+	const int radius;
+	const int windowSize;		//cells per side of the square around the target we cover
+	const Map* map = nullptr;
+	int targetRow = -1;
+	int targetColumn = -1;
+	int originRow = 0;			//top left cell of the window
+	int originColumn = 0;
+	bool isValid = false;
+
+	//indexed by getCellIndex(), a cell only counts if its generation matches the current one so we never have to clear
+	unsigned int generation = 0;
+	std::vector<unsigned int> cellGenerations;
+	std::vector<unsigned short> distances;
+	std::vector<signed char> directions;		//which way to step from this cell to get closer to the target
+	std::vector<int> frontier;					//scratch queue for rebuild()
+};
\ No newline at end of file
@@ -3,14 +3,21 @@
 #include "Player.h"
 #include "Map.h"
 #include "Teleporter.h"
-#include "Spawn.h"
-#include "Enemy.h"
+#include "World.h"
+#include "WorldLoader.h"
+#include "WorldCache.h"
+#include "FlowField.h"
+#include "JobSystem.h"
+#include "ThreadPool.h"
+#include "EntityStore.h"
+#include "TriggerIndex.h"
 #include "Texture.h"
+#include "TextureCache.h"
 #include "Constants.h"
 #include "Audio.h"
+#include "MapRegistry.h"
 #include "SDL_timer.h"
 #include "SDL_keycode.h"
-#include <fstream>
 #include <algorithm>
 
 #if _DEBUG
@@ -22,7 +29,7 @@ Game* Game::_instance;
 #pragma region Constructor
 
 Game::Game()
-	: previousFrameEndTime(0)
+	: previousFrameStartTime(0)
 {
 #if _DEBUG
 	assert(Game::_instance == nullptr);	//already initialized!
@@ -35,17 +42,32 @@ Game::Game()
 	//init camera
 	this->camera = { 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT };
 
-	//load initial map
-	std::vector<std::string> mapDataFilePaths = { STARTING_HOUSE_MAP_DATA_FILEPATH0, STARTING_HOUSE_MAP_DATA_FILEPATH1, STARTING_HOUSE_MAP_DATA_FILEPATH2 };
-	this->SwitchMap(mapDataFilePaths, INTERIOR_TILESET_TEXTURE_FILEPATH, STARTING_HOUSE_MAP_TELEPORTERS_FILEPATH, STARTING_HOUSE_MAP_SPAWNS_FILEPATH);
+	//init enemy pathfinding
+	this->flowField = new FlowField(FLOW_FIELD_RADIUS);
+
+	//workers for per-frame entity updates, this thread counts as one of them
+	this->jobSystem = new JobSystem(ThreadPool::GetDefaultThreadCount());
+
+	//keep the maps we leave around, so going back to one doesn't reload it
+	this->worldCache = new WorldCache(WORLD_CACHE_BYTE_BUDGET);
+	this->restoreCachedEntityState = WORLD_CACHE_RESTORE_ENTITY_STATE;
+
+	//created once and shared by every map load, rather than spinning threads up and down on each one
+	this->loadThreadPool = new ThreadPool(ThreadPool::GetDefaultThreadCount());
+
+	//load initial map, its teleporter destinations then load in the background
+	this->worldLoader = new WorldLoader(this->loadThreadPool);
+	this->SwitchMap(MapRegistry::GetHandle(STARTING_MAP_NAME));
 
 	//load heart texture for the UI
-	this->heartTexture = new Texture(HEART_TEXTURE_PATH);
-	this->heartTexture->Load();
+	this->heartTexture = TextureCache::Acquire(HEART_TEXTURE_PATH);
 
 	//start BG music
 	Audio::PlayAudio(Audio::AudioTracks::BG_MUSIC, true);
 
+	//loading the first map isn't time the simulation has to catch up on
+	this->previousFrameStartTime = SDL_GetTicks();
+
 	Game::_instance = this;
 }
 
@@ -55,19 +77,48 @@ Game::Game()
 
 Game::~Game()
 {
+	//stop background loads first, they may still be building worlds
+	if (this->worldLoader)
+	{
+		delete this->worldLoader;
+		this->worldLoader = nullptr;
+	}
+
 	this->cleanUpGameObjects();
 
+	if (this->worldCache)
+	{
+		delete this->worldCache;
+		this->worldCache = nullptr;
+	}
+
+	//nothing can be loading anymore once the world loader is gone
+	if (this->loadThreadPool)
+	{
+		delete this->loadThreadPool;
+		this->loadThreadPool = nullptr;
+	}
+
 	if (this->player)
 	{
 		delete this->player;
 		this->player = nullptr;
 	}
 
-	if (this->heartTexture)
+	if (this->flowField)
 	{
-		delete this->heartTexture;
-		this->heartTexture = nullptr;
+		delete this->flowField;
+		this->flowField = nullptr;
 	}
+
+	if (this->jobSystem)
+	{
+		delete this->jobSystem;
+		this->jobSystem = nullptr;
+	}
+
+	TextureCache::Release(this->heartTexture);
+	this->heartTexture = nullptr;
 }
 
 const Game* Game::GetInstance()
@@ -79,138 +130,48 @@ void Game::InjectFrame()
 {
 #if _DEBUG
 	assert(this->player);
-	assert(this->map);
+	assert(this->world);
 #endif
 
-	Uint32 elapsedTimeInMilliseconds = SDL_GetTicks();
+	const Uint32 frameStartTime = SDL_GetTicks();
 
-	const unsigned int previousFrameTime = elapsedTimeInMilliseconds - this->previousFrameEndTime;
+	//the simulation always steps by SIMULATION_TICK_TIME, however long frames take, so it plays out the same at any frame rate
+	this->unsimulatedTime += frameStartTime - this->previousFrameStartTime;
+	this->previousFrameStartTime = frameStartTime;
 
-	float frameTimeInMilliseconds = previousFrameTime / 1000.0f;
-
-	if (this->mapSwitchRequested)
+	int tickCount = 0;
+	while (this->unsimulatedTime >= SIMULATION_TICK_TIME)
 	{
-		const Destination& destination = this->destinationMapSwitch;
-		if (this->SwitchMap(destination.destinationMapFilePathsByLayer, destination.destinationMapTextureFilePath, destination.destinationTeleportersFilePath, destination.destinationSpawnsFilePath))
+		//too far behind (a hitch, a blocking map load), drop the rest instead of spiralling into ever longer frames
+		if (tickCount == SIMULATION_MAX_TICKS_PER_FRAME)
 		{
-			//move player to requested location in new map
-			this->player->SetPosition(destination.destinationX, destination.destinationY);
-
-			this->mapSwitchRequested = false;
+			this->unsimulatedTime %= SIMULATION_TICK_TIME;
+			break;
 		}
 
-		return;
-	}
-
-	//update player
-	this->player->InjectFrame(elapsedTimeInMilliseconds, previousFrameTime);
-	
-	//check if in teleporter
-	for (const Teleporter& tp : this->teleporters)
-	{
-		if (tp.TestCollision(this->player))
-		{
-			this->destinationMapSwitch = tp.GetDestination();
-			this->mapSwitchRequested = true;
-		}
-	}
-
-	//update spawns
-	for (Spawn* spawn : this->spawns)
-	{
-		spawn->InjectFrame(elapsedTimeInMilliseconds, previousFrameTime);
-	}
-
-	//update enemies
-	for (Enemy* enemy : this->enemies)
-	{
-		enemy->InjectFrame(elapsedTimeInMilliseconds, previousFrameTime);
-
-		//did our player and this enemy collide?
-		if (enemy->TestCollision(this->player))
-		{
-			//yup, punish the player!
-			if (this->onPlayerTakeDamageCooldown <= 0)
-			{
-				this->onPlayerTakeDamage();
-				this->onPlayerTakeDamageCooldown = PLAYER_TAKE_DAMAGE_COOLDOWN;
-
-				//also bounce the enemy away via recoil
-				enemy->DoRecoil(this->player->GetFacing());
-			}
-		}
-	}
-
-	if (this->onPlayerTakeDamageCooldown > 0)
-	{
-		this->onPlayerTakeDamageCooldown -= previousFrameTime;
-	}
-
-	//center the camera over the player
-	camera.x = (this->player->GetPositionX() + PLAYER_WIDTH / 2) - SCREEN_WIDTH / (2 * RENDER_SCALE_AMOUNT);
-	camera.y = (this->player->GetPositionY() + PLAYER_HEIGHT / 2) - SCREEN_HEIGHT / (2 * RENDER_SCALE_AMOUNT);
-
-	//Keep the camera in bounds
-	const int mapWidth = this->map->GetColumnCount() * TILE_WIDTH;
-	const int mapHeight = this->map->GetRowCount() * TILE_HEIGHT;
-	if (camera.x < 0)
-	{
-		camera.x = 0;
-	}
-	else if ((camera.x + (camera.w / 2)) > (mapWidth - (TILE_WIDTH / 2)))
-	{
-		camera.x = mapWidth - (camera.w / 2) - (TILE_WIDTH / 2);
-	}
-	if (camera.y < 0)
-	{
-		camera.y = 0;
-	}
-	else if ((camera.y + (camera.h / 2)) > (mapHeight - (TILE_HEIGHT / 2)))
-	{
-		camera.y = mapHeight - (camera.h / 2) - (TILE_HEIGHT / 2);
-	}
-
-	//now that updates are done, draw the frame
-	this->map->Draw(camera.x, camera.y);
-	this->player->Draw();
-	
-	for (Spawn* spawn : this->spawns)
-	{
-		spawn->Draw();
-	}
+		this->simulateTick();
 
-	for (Enemy* enemy : this->enemies)
-	{
-		enemy->Draw();
+		this->unsimulatedTime -= SIMULATION_TICK_TIME;
+		tickCount++;
 	}
 
-	//draw hearts ui
-	this->drawHeartsUI();
-
-	//slowly restore visibility to each layer
-	if (this->visibilityRestoreCooldown <= 0)
-	{
-		for (int layerIndex = 0; layerIndex < RenderLayers::NUM_LAYERS; layerIndex++)
-		{
-			RenderLayers layer = (RenderLayers)layerIndex;
-			Uint8 opacity = Display::GetRenderLayerOpacity(layer);
+	//draw between the last two ticks, by how far we are into the next one
+	this->interpolation = static_cast<double>(this->unsimulatedTime) / SIMULATION_TICK_TIME;
+	this->drawFrame();
+}
 
-			if (opacity < 0xFF)
-			{
-				opacity += 1;
-				Display::SetRenderLayerOpacity(layer, opacity);
-			}
-		}
+void Game::InjectTick()
+{
+#if _DEBUG
+	assert(this->player);
+	assert(this->world);
+#endif
 
-		this->visibilityRestoreCooldown = VISIBILITY_RESTORE_COOLDOWN;
-	}
-	else
-	{
-		this->visibilityRestoreCooldown -= previousFrameTime;
-	}
+	//exactly one tick, drawn right where it ends, for running the simulation flat out without a clock (e.g. headless)
+	this->simulateTick();
 
-	//end of frame
-	this->previousFrameEndTime = elapsedTimeInMilliseconds;
+	this->interpolation = 1.0;
+	this->drawFrame();
 }
 
 void Game::InjectKeyDown(int key)
@@ -277,37 +238,84 @@ void Game::InjectControllerStickMovement(unsigned char axis, short value)
 	}
 }
 
-bool Game::SwitchMap(const std::vector<std::string>& mapFilePathsByLayer, const std::string& mapTextureFilePath, const std::string& teleportersFilePath, const std::string& spawnsFilePath)
+void Game::InjectRenderTargetsReset()
 {
-	//nuke any existing map stuff we have loaded so we can make a fresh start (and not leak memory)
-	this->cleanUpGameObjects();
-
-	this->map = new Map(mapFilePathsByLayer, mapTextureFilePath);
-
-	if (!map)
-		return false;
+	if (this->world)
+	{
+		this->world->GetMap()->RebakeChunks();
+	}
 
-	bool loadTeleportersResult = this->loadTeleporters(teleportersFilePath);
+	this->worldCache->RebakeAll();
+}
 
+bool Game::SwitchMap(MapHandle mapHandle)
+{
 #if _DEBUG
-	assert(loadTeleportersResult);
+	assert(mapHandle != INVALID_MAP_HANDLE);
 #endif
 
-	if (!loadTeleportersResult)
+	if (mapHandle == INVALID_MAP_HANDLE)
 		return false;
 
-	bool loadSpawnsResult = this->loadSpawns(spawnsFilePath);
+	//somewhere we've just been is still in memory, exactly as we left it
+	World* world = this->worldCache->Take(mapHandle);
+	if (world != nullptr && !this->restoreCachedEntityState)
+	{
+		world->ResetEntities();
+	}
+
+	//teleporter destinations are built in the background, this only blocks if that load hasn't finished yet
+	if (world == nullptr)
+	{
+		world = this->worldLoader->Take(mapHandle);
+	}
+
+	if (world == nullptr)
+	{
+		//nothing preloaded, so load it right here
+		world = new World(mapHandle, this->loadThreadPool);
+		bool loadWorldResult = world->Load();
 
 #if _DEBUG
-	assert(loadSpawnsResult);
+		assert(loadWorldResult);
 #endif
 
-	if (!loadSpawnsResult)
+		if (!loadWorldResult)
+		{
+			delete world;
+			return false;
+		}
+	}
+
+	if (!world->FinishLoading())
+	{
+		delete world;
 		return false;
+	}
+
+	//park the old map and everything on it in the cache, then swap in the new one
+	this->cleanUpGameObjects();
+	this->world = world;
+	this->flowField->Invalidate();
+
+	//arriving on top of a trigger (e.g. the teleporter back) shouldn't fire it, only stepping into one does
+	this->world->GetTriggers().ResetOccupancy();
+
+	this->preloadDestinations();
 
 	return true;
 }
 
+void Game::SetWorldCacheByteBudget(size_t byteBudget)
+{
+	this->worldCache->SetByteBudget(byteBudget);
+}
+
+void Game::SetRestoreCachedEntityState(bool restoreCachedEntityState)
+{
+	this->restoreCachedEntityState = restoreCachedEntityState;
+}
+
 const Player* Game::GetPlayer() const
 {
 	return this->player;
@@ -315,7 +323,12 @@ const Player* Game::GetPlayer() const
 
 const Map* Game::GetMap() const
 {
-	return this->map;
+	return this->world ? this->world->GetMap() : nullptr;
+}
+
+const FlowField* Game::GetFlowField() const
+{
+	return this->flowField;
 }
 
 const SDL_Rect& Game::GetCamera() const
@@ -323,269 +336,221 @@ const SDL_Rect& Game::GetCamera() const
 	return this->camera;
 }
 
+double Game::GetInterpolation() const
+{
+	return this->interpolation;
+}
+
 #pragma endregion
 
 #pragma region Private Methods
 
 void Game::cleanUpGameObjects()
 {
-	this->teleporters.clear();
-
-	for (Spawn* spawn : this->spawns)
+	if (this->world)
 	{
-		delete spawn;
+		this->worldCache->Put(this->world);
+		this->world = nullptr;
 	}
-	this->spawns.clear();
+}
 
-	for (Enemy* enemy : this->enemies)
+void Game::preloadDestinations()
+{
+	//start building every map our teleporters lead to, anything preloaded for the old map that isn't one of them goes
+	std::vector<MapHandle> destinations;
+	for (const Teleporter& teleporter : this->world->GetTeleporters())
 	{
-		delete enemy;
-	}	
-	this->enemies.clear();
+		const MapHandle destinationMap = teleporter.GetDestination().destinationMap;
+
+		//nothing to load for where we already are or somewhere still cached
+		if (destinationMap == this->world->GetMapHandle() || this->worldCache->Contains(destinationMap))
+			continue;
+
+		if (std::find(destinations.begin(), destinations.end(), destinationMap) == destinations.end())
+			destinations.push_back(destinationMap);
+	}
+
+	this->worldLoader->Retain(destinations);
 
-	if (this->map)
+	for (MapHandle destination : destinations)
 	{
-		delete this->map;
-		this->map = nullptr;
+		this->worldLoader->Request(destination);
 	}
 }
 
-bool Game::loadTeleporters(const std::string& filepath)
+void Game::onPlayerTakeDamage()
 {
-	std::ifstream file(filepath.c_str());
+	//update player's HP
+	int playerHP = this->player->GetHp();
+	this->player->SetHp(playerHP - 1);
+	
+	//player audio for being hit
+	Audio::PlayAudio(Audio::AudioTracks::PLAYER_HIT, false);
 
-	if (!file.is_open())
-		return false;
+	//reduce visibility of a random layer (except UI)
+	int random = rand() % 4;
 
-	std::string line;
-	while (std::getline(file, line))
-	{
-		if (line.length() < 2)
-			continue;
+	RenderLayers layer = (RenderLayers)random;
 
-		//skip comment lines
-		if (line[0] == '-' && line[1] == '-')
-			continue;
+	Uint8 opacity = Display::GetRenderLayerOpacity(layer);
 
-		char* l = _strdup(line.c_str());
-
-		char* context = nullptr;
-
-		char* xPosToken = strtok_s(l, ";", &context);
-		char* yPosToken = strtok_s(nullptr, ";", &context);
-		char* destinationMapFilePathToken = strtok_s(nullptr, ";", &context);
-		char* destinationMapTextureFilePathToken = strtok_s(nullptr, ";", &context);
-		char* destinationTeleportersFilePathToken = strtok_s(nullptr, ";", &context);
-		char* destinationSpawnsFilePathToken = strtok_s(nullptr, ";", &context);
-		char* destinationXToken = strtok_s(nullptr, ";", &context);
-		char* destinationYToken = strtok_s(nullptr, ";", &context);
-
-		if ((xPosToken == nullptr) ||
-			(yPosToken == nullptr) ||
-			(destinationMapFilePathToken == nullptr) ||
-			(destinationMapTextureFilePathToken == nullptr) ||
-			(destinationTeleportersFilePathToken == nullptr) ||
-			(destinationSpawnsFilePathToken == nullptr) ||
-			(destinationXToken == nullptr) ||
-			(destinationYToken == nullptr))
-			return false;
+	//reduce it
+	if (opacity < ON_DAMAGE_VISIBILITY_REDUCE)
+	{
+		opacity = 0;
+	}
+	else
+	{
+		opacity -= ON_DAMAGE_VISIBILITY_REDUCE;
+	}
+	
+	Display::SetRenderLayerOpacity(layer, opacity);
+}
 
-		int xPos = atoi(xPosToken);
-		int yPos = atof(yPosToken);
-		std::string destinationMapFilePathsAsString = destinationMapFilePathToken;
-		std::string destinationMapTextureFilePath = destinationMapTextureFilePathToken;
-		std::string destinationTeleportersFilePath = destinationTeleportersFilePathToken;
-		std::string destinationSpawnsFilePath = destinationSpawnsFilePathToken;
-		int destinationX = atoi(destinationXToken);
-		int destinationY = atoi(destinationYToken);
-
-		//clear whitespace from destinationMapFilePathAsString
-		while (destinationMapFilePathsAsString.size() && isspace(destinationMapFilePathsAsString.front()))	//front
-			destinationMapFilePathsAsString.erase(destinationMapFilePathsAsString.begin());
-		while (destinationMapFilePathsAsString.size() && isspace(destinationMapFilePathsAsString.back()))	//back
-			destinationMapFilePathsAsString.pop_back();
-
-		//clear whitespace from destinationMapTextureFilePath
-		while (destinationMapTextureFilePath.size() && isspace(destinationMapTextureFilePath.front()))	//front
-			destinationMapTextureFilePath.erase(destinationMapTextureFilePath.begin());
-		while (destinationMapTextureFilePath.size() && isspace(destinationMapTextureFilePath.back()))	//back
-			destinationMapTextureFilePath.pop_back();
-
-		//clear whitespace from destinationTeleportersFilePath
-		while (destinationTeleportersFilePath.size() && isspace(destinationTeleportersFilePath.front()))	//front
-			destinationTeleportersFilePath.erase(destinationTeleportersFilePath.begin());
-		while (destinationTeleportersFilePath.size() && isspace(destinationTeleportersFilePath.back()))	//back
-			destinationTeleportersFilePath.pop_back();
-
-		//clear whitespace from destinationSpawnsFilePath
-		while (destinationSpawnsFilePath.size() && isspace(destinationSpawnsFilePath.front()))	//front
-			destinationSpawnsFilePath.erase(destinationSpawnsFilePath.begin());
-		while (destinationSpawnsFilePath.size() && isspace(destinationSpawnsFilePath.back()))	//back
-			destinationSpawnsFilePath.pop_back();
-
-		//split destinationMapFilePathsAsString in individual strings
-		std::vector<std::string> destinationMapFilePaths;
-
-		size_t startPosition = 0;
-		size_t endPosition = destinationMapFilePathsAsString.find(',', startPosition);
-		while (endPosition != std::string::npos)
+void Game::simulateTick()
+{
+	this->simulationTime += SIMULATION_TICK_TIME;
+
+	if (this->mapSwitchRequested)
+	{
+		const Destination& destination = this->destinationMapSwitch;
+		if (this->SwitchMap(destination.destinationMap))
 		{
-			destinationMapFilePaths.push_back(destinationMapFilePathsAsString.substr(startPosition, endPosition - startPosition));
+			//move player to requested location in new map
+			this->player->SetPosition(destination.destinationX, destination.destinationY);
 
-			startPosition = endPosition + 1; //+1 to skip delimiter
-			endPosition = destinationMapFilePathsAsString.find(',', startPosition);
+			this->mapSwitchRequested = false;
 		}
 
-		//double-check we've got one left to add
-#if _DEBUG
-		assert(startPosition != 0 && startPosition != std::string::npos);
-#endif
-
-		//no delimiter after last one, so we're done, but don't forget to include last
-		destinationMapFilePaths.push_back(destinationMapFilePathsAsString.substr(startPosition));
+		return;
+	}
 
-		//clear whitespace from destinationMapFilePaths
-		for (std::string& fp : destinationMapFilePaths)
-		{
-			while (fp.size() && isspace(fp.front()))	//front
-				fp.erase(fp.begin());
-			while (fp.size() && isspace(fp.back()))	//back
-				fp.pop_back();
-		}
+	//update player
+	this->player->InjectFrame(this->simulationTime, SIMULATION_TICK_TIME);
 
-		//all done, build our teleporter and add it to the set
-		this->teleporters.emplace_back(xPos, yPos, TELEPORTER_WIDTH, TELEPORTER_HEIGHT, destinationMapFilePaths, destinationMapTextureFilePath, destinationTeleportersFilePath, destinationSpawnsFilePath, destinationX, destinationY);
+	//enemies path towards the player's tile, only recomputed once they've moved into another one
+	const int playerTileRow = Map::GetTileAt(this->player->GetPositionY(), TILE_HEIGHT);
+	const int playerTileColumn = Map::GetTileAt(this->player->GetPositionX(), TILE_WIDTH);
+	this->flowField->Update(this->world->GetMap(), playerTileRow, playerTileColumn);
+	
+	//fire whatever triggers the player just stepped into (or out of), only the ones on the player's tiles are tested
+	TriggerIndex& triggers = this->world->GetTriggers();
+	triggers.Update(this->player->GetPositionX(), this->player->GetPositionY(), this->player->GetWidth(), this->player->GetHeight(), this->triggerEvents);
 
-		free(l);
-	}
+	for (const TriggerEvent& event : this->triggerEvents)
+	{
+		if (!event.isEnter)
+			continue;
 
-	file.close();
+		const Trigger& trigger = triggers.Get(event.triggerIndex);
+		switch (trigger.type)
+		{
+		case TriggerType::TELEPORT:
+			//overlapping teleporters, the first one entered wins
+			if (!this->mapSwitchRequested)
+			{
+				this->destinationMapSwitch = this->world->GetTeleporters()[trigger.payloadIndex].GetDestination();
+				this->mapSwitchRequested = true;
+			}
+			break;
 
-	return true;
-}
+		default:
+#if _DEBUG
+			assert(false);	//unhandled trigger type
+#endif
+			break;
+		}
+	}
 
-bool Game::loadSpawns(const std::string& filepath)
-{
-	std::ifstream file(filepath.c_str());
+	//update spawns and enemies, at a rate depending on how far they are from the camera (last frame's, it only moves a few pixels a frame)
+	EntityStore& entities = this->world->GetEntities();
+	entities.Update(this->world->GetMap(), this->flowField, this->player->GetPositionX(), this->player->GetPositionY(), this->camera, SIMULATION_TICK_TIME, this->jobSystem);
 
-	if (!file.is_open())
-		return false;
+	//everything the player is touching, the spatial hash batch tests its candidates with the collision kernel
+	entities.GetSpatialHash().QueryRect(this->player->GetPositionX(), this->player->GetPositionY(), this->player->GetWidth(), this->player->GetHeight(), this->nearbyEntities);
 
-	std::string line;
-	while (std::getline(file, line))
+	for (int i : this->nearbyEntities)
 	{
-		if (line.length() < 2)
-			continue;
-
-		//skip comment lines
-		if (line[0] == '-' && line[1] == '-')
+		//did our player and an enemy collide?
+		if (!entities.GetIsEnemy(i))
 			continue;
 
-		char* l = _strdup(line.c_str());
-
-		char* context = NULL;
-
-		char* idToken = strtok_s(l, ",", &context);
-		char* spawnXToken = strtok_s(NULL, ",", &context);
-		char* spawnYToken = strtok_s(NULL, ",", &context);
-		char* widthToken = strtok_s(NULL, ",", &context);
-		char* heightToken = strtok_s(NULL, ",", &context);
-		char* texturePathToken = strtok_s(NULL, ",", &context);
-		char* spriteOffsetXToken = strtok_s(NULL, ",", &context);
-		char* spriteOffsetYToken = strtok_s(NULL, ",", &context);
-		char* shouldIdleMoveToken = strtok_s(NULL, ",", &context);
-		char* isEnemyToken = strtok_s(NULL, ",", &context);
-
-		if ((idToken == NULL) ||
-			(spawnXToken == NULL) ||
-			(spawnYToken == NULL) ||
-			(widthToken == NULL) ||
-			(heightToken == NULL) ||
-			(texturePathToken == NULL) ||
-			(spriteOffsetXToken == NULL) ||
-			(spriteOffsetYToken == NULL) ||
-			(shouldIdleMoveToken == NULL) ||
-			(isEnemyToken == NULL))
-			return false;
-
-		int id = atoi(idToken);
-		double spawnX = atof(spawnXToken);
-		double spawnY = atof(spawnYToken);
-		int width = atoi(widthToken);
-		int height = atoi(heightToken);
-		std::string texturePath = texturePathToken;
-		int spriteOffsetX = atoi(spriteOffsetXToken);
-		int spriteOffsetY = atoi(spriteOffsetYToken);
-
-		std::string shouldIdleMoveAsString(shouldIdleMoveToken);
-		//clear whitespace from shouldIdleMoveAsString
-		while (shouldIdleMoveAsString.size() && isspace(shouldIdleMoveAsString.front()))	//front
-			shouldIdleMoveAsString.erase(shouldIdleMoveAsString.begin());
-		while (shouldIdleMoveAsString.size() && isspace(shouldIdleMoveAsString.back()))	//back
-			shouldIdleMoveAsString.pop_back();
-		std::transform(shouldIdleMoveAsString.begin(), shouldIdleMoveAsString.end(), shouldIdleMoveAsString.begin(), ::tolower);
-		bool shouldIdleMove = shouldIdleMoveAsString.compare("true") == 0;
-
-		std::string isEnemyAsString(isEnemyToken);
-		//clear whitespace from isEnemyAsString
-		while (isEnemyAsString.size() && isspace(isEnemyAsString.front()))	//front
-			isEnemyAsString.erase(isEnemyAsString.begin());
-		while (isEnemyAsString.size() && isspace(isEnemyAsString.back()))	//back
-			isEnemyAsString.pop_back();
-		std::transform(isEnemyAsString.begin(), isEnemyAsString.end(), isEnemyAsString.begin(), ::tolower);
-		bool isEnemy = isEnemyAsString.compare("true") == 0;
-
-		//clear whitespace from texturePath
-		while (texturePath.size() && isspace(texturePath.front()))	//front
-			texturePath.erase(texturePath.begin());
-		while (texturePath.size() && isspace(texturePath.back()))	//back
-			texturePath.pop_back();
-
-		//create it
-		if (isEnemy)
+		//yup, punish the player!
+		if (this->onPlayerTakeDamageCooldown <= 0)
 		{
-			this->enemies.push_back(new Enemy(id, spawnX, spawnY, width, height, texturePath, spriteOffsetX, spriteOffsetY, shouldIdleMove));
-		}
-		else
-		{
-			this->spawns.push_back(new Spawn(id, spawnX, spawnY, width, height, texturePath, spriteOffsetX, spriteOffsetY, shouldIdleMove));
+			this->onPlayerTakeDamage();
+			this->onPlayerTakeDamageCooldown = PLAYER_TAKE_DAMAGE_COOLDOWN;
+
+			//also bounce the enemy away via recoil
+			entities.DoRecoil(i, this->world->GetMap(), this->player->GetFacing());
 		}
+	}
 
-		free(l);
+	if (this->onPlayerTakeDamageCooldown > 0)
+	{
+		this->onPlayerTakeDamageCooldown -= SIMULATION_TICK_TIME;
 	}
 
-	file.close();
+	//slowly restore visibility to each layer
+	if (this->visibilityRestoreCooldown <= 0)
+	{
+		for (int layerIndex = 0; layerIndex < RenderLayers::NUM_LAYERS; layerIndex++)
+		{
+			RenderLayers layer = (RenderLayers)layerIndex;
+			Uint8 opacity = Display::GetRenderLayerOpacity(layer);
 
-	return true;
+			if (opacity < 0xFF)
+			{
+				opacity += 1;
+				Display::SetRenderLayerOpacity(layer, opacity);
+			}
+		}
+
+		this->visibilityRestoreCooldown = VISIBILITY_RESTORE_COOLDOWN;
+	}
+	else
+	{
+		this->visibilityRestoreCooldown -= SIMULATION_TICK_TIME;
+	}
 }
 
-void Game::onPlayerTakeDamage()
+void Game::drawFrame()
 {
-	//update player's HP
-	int playerHP = this->player->GetHp();
-	this->player->SetHp(playerHP - 1);
-	
-	//player audio for being hit
-	Audio::PlayAudio(Audio::AudioTracks::PLAYER_HIT, false);
-
-	//reduce visibility of a random layer (except UI)
-	int random = rand() % 4;
-
-	RenderLayers layer = (RenderLayers)random;
-
-	Uint8 opacity = Display::GetRenderLayerOpacity(layer);
+	//center the camera over where the player is drawn, not where the last tick left them, or the world would jitter around them
+	camera.x = (this->player->GetInterpolatedPositionX(this->interpolation) + PLAYER_WIDTH / 2) - SCREEN_WIDTH / (2 * RENDER_SCALE_AMOUNT);
+	camera.y = (this->player->GetInterpolatedPositionY(this->interpolation) + PLAYER_HEIGHT / 2) - SCREEN_HEIGHT / (2 * RENDER_SCALE_AMOUNT);
 
-	//reduce it
-	if (opacity < ON_DAMAGE_VISIBILITY_REDUCE)
+	//Keep the camera in bounds
+	const int mapWidth = this->world->GetMap()->GetColumnCount() * TILE_WIDTH;
+	const int mapHeight = this->world->GetMap()->GetRowCount() * TILE_HEIGHT;
+	if (camera.x < 0)
 	{
-		opacity = 0;
+		camera.x = 0;
 	}
-	else
+	else if ((camera.x + (camera.w / 2)) > (mapWidth - (TILE_WIDTH / 2)))
 	{
-		opacity -= ON_DAMAGE_VISIBILITY_REDUCE;
+		camera.x = mapWidth - (camera.w / 2) - (TILE_WIDTH / 2);
 	}
+	if (camera.y < 0)
+	{
+		camera.y = 0;
+	}
+	else if ((camera.y + (camera.h / 2)) > (mapHeight - (TILE_HEIGHT / 2)))
+	{
+		camera.y = mapHeight - (camera.h / 2) - (TILE_HEIGHT / 2);
+	}
+
+	//stream in whatever part of the map the camera is heading towards (no-op for maps that are fully loaded)
+	this->world->GetMap()->UpdateStreaming(camera.x, camera.y);
+
+	//draw the map, then everything on it
+	this->world->GetMap()->Draw(camera.x, camera.y);
+	this->player->Draw();
 	
-	Display::SetRenderLayerOpacity(layer, opacity);
+	this->world->GetEntities().Draw(this->camera, this->interpolation, this->jobSystem);
+
+	//draw hearts ui
+	this->drawHeartsUI();
 }
 
 void Game::drawHeartsUI()
@@ -1,15 +1,20 @@
 #pragma once
 #include "SDL_rect.h"
 #include "Teleporter.h"
+#include "TriggerIndex.h"
 #include <vector>
 #include <string>
 
 #pragma region Forward Declarations
 class Player;
 class Map;
-class Spawn;
-class Enemy;
 class Texture;
+class World;
+class WorldLoader;
+class WorldCache;
+class FlowField;
+class JobSystem;
+class ThreadPool;
 #pragma endregion
 
 class Game
@@ -21,35 +26,49 @@ public:
 	static const Game* GetInstance();
 
 	void InjectFrame();
+	void InjectTick();
 	void InjectKeyDown(int key);
 	void InjectKeyUp(int key);
 	void InjectControllerStickMovement(unsigned char axis, short value);
+	void InjectRenderTargetsReset();
 
-	bool SwitchMap(const std::vector<std::string>& mapFilePathsByLayer, const std::string& mapTextureFilePath, const std::string& teleportersFilePath, const std::string& spawnsFilePath);
+	bool SwitchMap(MapHandle mapHandle);
+
+	void SetWorldCacheByteBudget(size_t byteBudget);
+	void SetRestoreCachedEntityState(bool restoreCachedEntityState);
 
 	const Player* GetPlayer() const;
 
 	const Map* GetMap() const;
 
+	const FlowField* GetFlowField() const;
+
 	const SDL_Rect& GetCamera() const;
 
+	double GetInterpolation() const;
+
 private:
 
+	void simulateTick();
+	void drawFrame();
 	void drawHeartsUI();
 	void cleanUpGameObjects();
-	bool loadTeleporters(const std::string& filepath);
-	bool loadSpawns(const std::string& filepath);
+	void preloadDestinations();
 	void onPlayerTakeDamage();
 
 	Player* player;
-	Map* map;
+	World* world = nullptr;				//the active map and everything on it
+	ThreadPool* loadThreadPool = nullptr;	//parses map files for every World we load, on this thread or the world loader's
+	WorldLoader* worldLoader = nullptr;	//builds the worlds our teleporters lead to ahead of time
+	WorldCache* worldCache = nullptr;	//the worlds we've recently left
+	FlowField* flowField = nullptr;		//how to reach the player, sampled by every chasing enemy
+	JobSystem* jobSystem = nullptr;		//spreads entity updates and culling over every core
+	std::vector<int> nearbyEntities;	//scratch for spatial hash queries, kept around so we don't allocate every frame
+	std::vector<TriggerEvent> triggerEvents;	//scratch for trigger updates
+	bool restoreCachedEntityState;		//false resets a cached world's spawns when we go back to it
 	
 	SDL_Rect camera;
 
-	std::vector<Spawn*> spawns;
-	std::vector<Enemy*> enemies;
-	std::vector<Teleporter> teleporters;
-
 	int onPlayerTakeDamageCooldown = 0;
 	int visibilityRestoreCooldown = 0;
 
@@ -58,7 +77,10 @@ private:
 	Destination destinationMapSwitch;
 	bool mapSwitchRequested = false;
 
-	unsigned int previousFrameEndTime;
+	unsigned int previousFrameStartTime;
+	unsigned int unsimulatedTime = 0;	//in milliseconds, frame time not yet covered by a tick
+	unsigned int simulationTime = 0;	//in milliseconds, SIMULATION_TICK_TIME per tick simulated so far
+	double interpolation = 0.0;			//0 draws the previous tick, 1 the latest, the frame lands somewhere in between
 
 	static Game* _instance;
 };
\ No newline at end of file
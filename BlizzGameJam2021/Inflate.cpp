@@ -0,0 +1,387 @@
+#include "Inflate.h"
+
+#define INFLATE_MAX_BITS		15
+#define INFLATE_MAX_LENGTH_CODES	286
+#define INFLATE_MAX_DISTANCE_CODES	30
+#define INFLATE_FIXED_LENGTH_CODES	288
+
+#pragma region Decoder State
+
+namespace
+{
+	struct Huffman
+	{
+		short count[INFLATE_MAX_BITS + 1];		//number of symbols of each code length
+		short symbol[INFLATE_FIXED_LENGTH_CODES];	//symbols ordered by code
+	};
+
+	struct InflateState
+	{
+		const unsigned char* source;
+		size_t sourceLength;
+		size_t sourcePosition;
+		unsigned int bitBuffer;
+		int bitCount;
+		bool overrun;
+		std::vector<unsigned char>* output;
+	};
+
+	const short lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	const short lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	const short distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	const short distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+	const short codeLengthOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+	int readBits(InflateState& state, int need)
+	{
+		unsigned int value = state.bitBuffer;
+		while (state.bitCount < need)
+		{
+			if (state.sourcePosition >= state.sourceLength)
+			{
+				state.overrun = true;
+				return 0;
+			}
+
+			value |= static_cast<unsigned int>(state.source[state.sourcePosition++]) << state.bitCount;
+			state.bitCount += 8;
+		}
+
+		state.bitBuffer = value >> need;
+		state.bitCount -= need;
+
+		return static_cast<int>(value & ((1u << need) - 1));
+	}
+
+	//returns 0 for a complete code, > 0 for an incomplete one and < 0 for an over-subscribed one
+	int buildHuffman(Huffman& huffman, const short* lengths, int symbolCount)
+	{
+		for (int length = 0; length <= INFLATE_MAX_BITS; length++)
+			huffman.count[length] = 0;
+
+		for (int symbol = 0; symbol < symbolCount; symbol++)
+			huffman.count[lengths[symbol]]++;
+
+		if (huffman.count[0] == symbolCount)
+			return 0;
+
+		int left = 1;
+		for (int length = 1; length <= INFLATE_MAX_BITS; length++)
+		{
+			left <<= 1;
+			left -= huffman.count[length];
+			if (left < 0)
+				return left;
+		}
+
+		short offsets[INFLATE_MAX_BITS + 1];
+		offsets[1] = 0;
+		for (int length = 1; length < INFLATE_MAX_BITS; length++)
+			offsets[length + 1] = offsets[length] + huffman.count[length];
+
+		for (int symbol = 0; symbol < symbolCount; symbol++)
+		{
+			if (lengths[symbol] != 0)
+				huffman.symbol[offsets[lengths[symbol]]++] = symbol;
+		}
+
+		return left;
+	}
+
+	int decodeSymbol(InflateState& state, const Huffman& huffman)
+	{
+		int code = 0;
+		int first = 0;
+		int index = 0;
+
+		for (int length = 1; length <= INFLATE_MAX_BITS; length++)
+		{
+			code |= readBits(state, 1);
+			if (state.overrun)
+				return -1;
+
+			const int count = huffman.count[length];
+			if (code - count < first)
+				return huffman.symbol[index + (code - first)];
+
+			index += count;
+			first += count;
+			first <<= 1;
+			code <<= 1;
+		}
+
+		return -1;
+	}
+
+	bool inflateStored(InflateState& state)
+	{
+		//stored blocks start on a byte boundary
+		state.bitBuffer = 0;
+		state.bitCount = 0;
+
+		if (state.sourcePosition + 4 > state.sourceLength)
+			return false;
+
+		const unsigned int length = state.source[state.sourcePosition] | (state.source[state.sourcePosition + 1] << 8);
+		const unsigned int lengthComplement = state.source[state.sourcePosition + 2] | (state.source[state.sourcePosition + 3] << 8);
+		state.sourcePosition += 4;
+
+		if (length != (~lengthComplement & 0xffff) || state.sourcePosition + length > state.sourceLength)
+			return false;
+
+		state.output->insert(state.output->end(), state.source + state.sourcePosition, state.source + state.sourcePosition + length);
+		state.sourcePosition += length;
+
+		return true;
+	}
+
+	bool inflateCodes(InflateState& state, const Huffman& lengthCodes, const Huffman& distanceCodes)
+	{
+		std::vector<unsigned char>& output = *state.output;
+
+		while (true)
+		{
+			int symbol = decodeSymbol(state, lengthCodes);
+			if (symbol < 0)
+				return false;
+
+			if (symbol < 256)
+			{
+				output.push_back(static_cast<unsigned char>(symbol));
+				continue;
+			}
+
+			if (symbol == 256)
+				return true;
+
+			//length/distance pair, copy from earlier in the output
+			symbol -= 257;
+			if (symbol >= 29)
+				return false;
+
+			const int length = lengthBase[symbol] + readBits(state, lengthExtra[symbol]);
+
+			symbol = decodeSymbol(state, distanceCodes);
+			if (symbol < 0 || symbol >= 30)
+				return false;
+
+			const size_t distance = distanceBase[symbol] + readBits(state, distanceExtra[symbol]);
+			if (state.overrun || distance > output.size())
+				return false;
+
+			size_t from = output.size() - distance;
+			for (int i = 0; i < length; i++)
+			{
+				output.push_back(output[from++]);
+			}
+		}
+	}
+
+	Huffman buildFixedLengthCodes()
+	{
+		short lengths[INFLATE_FIXED_LENGTH_CODES];
+		int symbol = 0;
+		for (; symbol < 144; symbol++) lengths[symbol] = 8;
+		for (; symbol < 256; symbol++) lengths[symbol] = 9;
+		for (; symbol < 280; symbol++) lengths[symbol] = 7;
+		for (; symbol < INFLATE_FIXED_LENGTH_CODES; symbol++) lengths[symbol] = 8;
+
+		Huffman lengthCodes;
+		buildHuffman(lengthCodes, lengths, INFLATE_FIXED_LENGTH_CODES);
+
+		return lengthCodes;
+	}
+
+	Huffman buildFixedDistanceCodes()
+	{
+		short lengths[INFLATE_MAX_DISTANCE_CODES];
+		for (int symbol = 0; symbol < INFLATE_MAX_DISTANCE_CODES; symbol++) lengths[symbol] = 5;
+
+		Huffman distanceCodes;
+		buildHuffman(distanceCodes, lengths, INFLATE_MAX_DISTANCE_CODES);
+
+		return distanceCodes;
+	}
+
+	bool inflateFixed(InflateState& state)
+	{
+		//built once on first use, function local statics are thread safe so maps can decompress on the loader thread and the main thread at once
+		static const Huffman lengthCodes = buildFixedLengthCodes();
+		static const Huffman distanceCodes = buildFixedDistanceCodes();
+
+		return inflateCodes(state, lengthCodes, distanceCodes);
+	}
+
+	bool inflateDynamic(InflateState& state)
+	{
+		const int lengthCount = readBits(state, 5) + 257;
+		const int distanceCount = readBits(state, 5) + 1;
+		const int codeLengthCount = readBits(state, 4) + 4;
+
+		if (state.overrun || lengthCount > INFLATE_MAX_LENGTH_CODES || distanceCount > INFLATE_MAX_DISTANCE_CODES)
+			return false;
+
+		short lengths[INFLATE_MAX_LENGTH_CODES + INFLATE_MAX_DISTANCE_CODES];
+
+		//code lengths for the code length alphabet
+		int index = 0;
+		for (; index < codeLengthCount; index++)
+			lengths[codeLengthOrder[index]] = readBits(state, 3);
+		for (; index < 19; index++)
+			lengths[codeLengthOrder[index]] = 0;
+
+		Huffman lengthCodes;
+		if (state.overrun || buildHuffman(lengthCodes, lengths, 19) != 0)
+			return false;
+
+		//literal/length and distance code lengths, run length encoded
+		index = 0;
+		while (index < lengthCount + distanceCount)
+		{
+			int symbol = decodeSymbol(state, lengthCodes);
+			if (symbol < 0)
+				return false;
+
+			if (symbol < 16)
+			{
+				lengths[index++] = symbol;
+				continue;
+			}
+
+			short repeatedLength = 0;
+			int repeat = 0;
+			if (symbol == 16)
+			{
+				if (index == 0)
+					return false;
+
+				repeatedLength = lengths[index - 1];
+				repeat = 3 + readBits(state, 2);
+			}
+			else if (symbol == 17)
+			{
+				repeat = 3 + readBits(state, 3);
+			}
+			else
+			{
+				repeat = 11 + readBits(state, 7);
+			}
+
+			if (state.overrun || index + repeat > lengthCount + distanceCount)
+				return false;
+
+			while (repeat--)
+				lengths[index++] = repeatedLength;
+		}
+
+		//a block without an end-of-block code can't be valid
+		if (lengths[256] == 0)
+			return false;
+
+		Huffman distanceCodes;
+		int result = buildHuffman(lengthCodes, lengths, lengthCount);
+		if (result < 0 || (result > 0 && lengthCount - lengthCodes.count[0] != 1))
+			return false;
+
+		result = buildHuffman(distanceCodes, lengths + lengthCount, distanceCount);
+		if (result < 0 || (result > 0 && distanceCount - distanceCodes.count[0] != 1))
+			return false;
+
+		return inflateCodes(state, lengthCodes, distanceCodes);
+	}
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+bool Inflate::Decompress(const unsigned char* source, size_t sourceLength, std::vector<unsigned char>& output)
+{
+	if (sourceLength < 2)
+		return false;
+
+	//gzip wrapper
+	if (source[0] == 0x1f && source[1] == 0x8b)
+	{
+		if (sourceLength < 18 || source[2] != 8)
+			return false;
+
+		const unsigned char flags = source[3];
+		size_t position = 10;
+
+		if (flags & 0x04)	//FEXTRA
+		{
+			if (position + 2 > sourceLength)
+				return false;
+
+			position += 2 + (source[position] | (source[position + 1] << 8));
+		}
+
+		if (flags & 0x08)	//FNAME
+		{
+			while (position < sourceLength && source[position] != 0)
+				position++;
+			position++;
+		}
+
+		if (flags & 0x10)	//FCOMMENT
+		{
+			while (position < sourceLength && source[position] != 0)
+				position++;
+			position++;
+		}
+
+		if (flags & 0x02)	//FHCRC
+			position += 2;
+
+		if (position >= sourceLength)
+			return false;
+
+		return Inflate::DecompressRaw(source + position, sourceLength - position, output);
+	}
+
+	//zlib wrapper
+	const unsigned int header = (source[0] << 8) | source[1];
+	if ((source[0] & 0x0f) == 8 && (header % 31) == 0)
+	{
+		//preset dictionaries are never used for map data
+		if (source[1] & 0x20)
+			return false;
+
+		return Inflate::DecompressRaw(source + 2, sourceLength - 2, output);
+	}
+
+	return Inflate::DecompressRaw(source, sourceLength, output);
+}
+
+bool Inflate::DecompressRaw(const unsigned char* source, size_t sourceLength, std::vector<unsigned char>& output)
+{
+	InflateState state = { source, sourceLength, 0, 0, 0, false, &output };
+
+	bool lastBlock = false;
+	while (!lastBlock)
+	{
+		lastBlock = readBits(state, 1) == 1;
+		const int type = readBits(state, 2);
+
+		if (state.overrun)
+			return false;
+
+		bool blockSuccess = false;
+		switch (type)
+		{
+		case 0:	blockSuccess = inflateStored(state);	break;
+		case 1:	blockSuccess = inflateFixed(state);		break;
+		case 2:	blockSuccess = inflateDynamic(state);	break;
+		default:
+			break;
+		}
+
+		if (!blockSuccess)
+			return false;
+	}
+
+	return true;
+}
+
+#pragma endregion
\ No newline at end of file
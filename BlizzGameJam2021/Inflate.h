@@ -0,0 +1,14 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+//small DEFLATE decoder for compressed map data (zlib and gzip streams, or raw deflate)
+class Inflate
+{
+public:
+	Inflate() = delete;
+
+	static bool Decompress(const unsigned char* source, size_t sourceLength, std::vector<unsigned char>& output);
+	static bool DecompressRaw(const unsigned char* source, size_t sourceLength, std::vector<unsigned char>& output);
+};
\ No newline at end of file
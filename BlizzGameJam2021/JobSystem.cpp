@@ -0,0 +1,193 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Constructor
+
+JobSystem::JobSystem(int workerCount)
+{
+#if _DEBUG
+	assert(workerCount > 0);
+#endif
+
+	for (int i = 0; i < workerCount; i++)
+	{
+		this->queues.push_back(new WorkerQueue());
+	}
+
+	//the calling thread is worker 0, so we only need threads for the rest
+	this->workers.reserve(workerCount - 1);
+	for (int i = 1; i < workerCount; i++)
+	{
+		this->workers.emplace_back(&JobSystem::workerLoop, this, i);
+	}
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->batchMutex);
+		this->stopRequested = true;
+	}
+	this->wakeCondition.notify_all();
+
+	for (std::thread& worker : this->workers)
+	{
+		worker.join();
+	}
+
+	for (WorkerQueue* queue : this->queues)
+	{
+		delete queue;
+	}
+	this->queues.clear();
+}
+
+void JobSystem::ParallelFor(int count, int grainSize, const ParallelForJob& job)
+{
+#if _DEBUG
+	assert(grainSize > 0);
+	assert(this->remainingChunkCount == 0);	//no nesting, and only the thread that owns us may call this
+#endif
+
+	const int chunkCount = JobSystem::GetChunkCount(count, grainSize);
+	if (chunkCount == 0)
+		return;
+
+	//not worth waking anyone up for
+	if (chunkCount == 1 || this->workers.empty())
+	{
+		for (int chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+		{
+			job(chunkIndex * grainSize, std::min(count, (chunkIndex + 1) * grainSize), chunkIndex, 0);
+		}
+		return;
+	}
+
+	this->job = &job;
+	this->count = count;
+	this->grainSize = grainSize;
+	this->remainingChunkCount = chunkCount;
+
+	//hand every worker a contiguous block of chunks to start with, stealing evens things out when some run slower
+	const int workerCount = this->GetWorkerCount();
+	for (int workerIndex = 0; workerIndex < workerCount; workerIndex++)
+	{
+		const int firstChunk = (chunkCount * workerIndex) / workerCount;
+		const int lastChunk = (chunkCount * (workerIndex + 1)) / workerCount;
+
+		std::lock_guard<std::mutex> lock(this->queues[workerIndex]->mutex);
+		for (int chunkIndex = firstChunk; chunkIndex < lastChunk; chunkIndex++)
+		{
+			this->queues[workerIndex]->chunks.push_back(chunkIndex);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->batchMutex);
+		this->batchGeneration++;
+	}
+	this->wakeCondition.notify_all();
+
+	this->runChunks(0);
+
+	//whatever is left is already running on a worker
+	std::unique_lock<std::mutex> lock(this->batchMutex);
+	this->doneCondition.wait(lock, [this]() { return this->remainingChunkCount == 0; });
+
+	this->job = nullptr;
+}
+
+int JobSystem::GetWorkerCount() const
+{
+	return static_cast<int>(this->queues.size());
+}
+
+int JobSystem::GetChunkCount(int count, int grainSize)
+{
+	return (count + grainSize - 1) / grainSize;
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+void JobSystem::workerLoop(int workerIndex)
+{
+	unsigned int seenBatchGeneration = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(this->batchMutex);
+			this->wakeCondition.wait(lock, [this, seenBatchGeneration]() { return this->stopRequested || this->batchGeneration != seenBatchGeneration; });
+
+			if (this->stopRequested)
+				return;
+
+			seenBatchGeneration = this->batchGeneration;
+		}
+
+		this->runChunks(workerIndex);
+	}
+}
+
+void JobSystem::runChunks(int workerIndex)
+{
+	int chunkIndex;
+	while (this->popChunk(workerIndex, chunkIndex) || this->stealChunk(workerIndex, chunkIndex))
+	{
+		const int first = chunkIndex * this->grainSize;
+		const int last = std::min(this->count, first + this->grainSize);
+		(*this->job)(first, last, chunkIndex, workerIndex);
+
+		if (this->remainingChunkCount.fetch_sub(1) == 1)
+		{
+			//take the lock so the caller can't miss this between checking the count and going to sleep
+			std::lock_guard<std::mutex> lock(this->batchMutex);
+			this->doneCondition.notify_all();
+		}
+	}
+}
+
+bool JobSystem::popChunk(int workerIndex, int& chunkIndex)
+{
+	WorkerQueue* queue = this->queues[workerIndex];
+	std::lock_guard<std::mutex> lock(queue->mutex);
+
+	if (queue->chunks.empty())
+		return false;
+
+	chunkIndex = queue->chunks.front();
+	queue->chunks.pop_front();
+	return true;
+}
+
+bool JobSystem::stealChunk(int workerIndex, int& chunkIndex)
+{
+	//start with our neighbour so thieves don't all pile onto the same queue
+	const int workerCount = this->GetWorkerCount();
+	for (int offset = 1; offset < workerCount; offset++)
+	{
+		WorkerQueue* victim = this->queues[(workerIndex + offset) % workerCount];
+		std::lock_guard<std::mutex> lock(victim->mutex);
+
+		if (victim->chunks.empty())
+			continue;
+
+		chunkIndex = victim->chunks.back();
+		victim->chunks.pop_back();
+		return true;
+	}
+
+	return false;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+//runs one chunk of a ParallelFor: entities [first, last), chunkIndex is stable for a given count and grain size, workerIndex is whoever picked it up (0 is the calling thread)
+typedef std::function<void(int first, int last, int chunkIndex, int workerIndex)> ParallelForJob;
+
+//fixed set of worker threads for per-frame work, each with its own queue of chunks and stealing from the others once it runs dry
+//unlike ThreadPool the calling thread joins in, and ParallelFor() only returns once every chunk has run
+class JobSystem
+{
+public:
+	JobSystem(int workerCount);
+	~JobSystem();
+
+	void ParallelFor(int count, int grainSize, const ParallelForJob& job);
+
+	int GetWorkerCount() const;
+
+	static int GetChunkCount(int count, int grainSize);
+
+private:
+	struct WorkerQueue
+	{
+		std::mutex mutex;
+		std::deque<int> chunks;		//chunk indices, the owner takes from the front and thieves from the back
+	};
+
+	void workerLoop(int workerIndex);
+	void runChunks(int workerIndex);
+	bool popChunk(int workerIndex, int& chunkIndex);
+	bool stealChunk(int workerIndex, int& chunkIndex);
+
+	std::vector<std::thread> workers;
+	std::vector<WorkerQueue*> queues;		//one per worker, index 0 belongs to the calling thread
+
+	//the batch being run, only written by ParallelFor() while no chunks are queued
+	const ParallelForJob* job = nullptr;
+	int count = 0;
+	int grainSize = 0;
+
+	std::atomic<int> remainingChunkCount{ 0 };
+
+	//wakes the workers for a new batch, guarded by batchMutex
+	std::mutex batchMutex;
+	std::condition_variable wakeCondition;		//signalled when a batch starts or we're stopping
+	std::condition_variable doneCondition;		//signalled when the last chunk of a batch finishes
+	unsigned int batchGeneration = 0;
+	bool stopRequested = false;
+};
\ No newline at end of file
@@ -1,38 +1,133 @@
 #include "Map.h"
 #include "MapTile.h"
+#include "MapChunkStreamer.h"
+#include "MapBundle.h"
+#include "TmxLoader.h"
+#include "CsvMapLoader.h"
 #include "Texture.h"
+#include "TextureCache.h"
+#include "Display.h"
+#include "Constants.h"
 #include <fstream>
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 
 #ifdef _DEBUG
 	#include <assert.h>
 #endif
 
-#define DEFAULT_EMPTY_MAP_TILE_ID 853
+#define WALKABLE_BITS_PER_WORD 32
 
 #pragma region Constructor
 
-Map::Map(const std::vector<std::string>& tileDataFilePathsByLayer, const std::string& textureFilepath)
+Map::Map(const std::vector<std::string>& tileDataFilePathsByLayer, TilesetHandle tilesetHandle, ThreadPool* threadPool)
 {
-	bool tileInitSuccess = MapTile::InitInteriorTileInfo();	//needs to happen before readDataFile below
+	this->tilesetHandle = tilesetHandle;
 
-	const int numberOfLayers = tileDataFilePathsByLayer.size();
-	for (int layer = 0; layer < numberOfLayers; layer++)
+#if _DEBUG
+	assert(this->tilesetHandle != INVALID_TILESET_HANDLE);
+#endif
+
+	this->numberOfLayers = tileDataFilePathsByLayer.size();
+
+	if (this->shouldStreamDataFile(tileDataFilePathsByLayer.at(0)))
 	{
-		const std::string& filepath = tileDataFilePathsByLayer.at(layer);
-		bool readDataSuccess = this->readDataFile(filepath, layer);
+		//too big to load up front, index the files now and let the streamer load chunks around the camera in the background
+		this->chunkStreamer = new MapChunkStreamer(tileDataFilePathsByLayer, this->tilesetHandle, MAP_RESIDENT_CHUNK_BUDGET);
+		bool streamerInitSuccess = this->chunkStreamer->Initialize(threadPool);
+
+#if _DEBUG
+		assert(streamerInitSuccess);
+#endif
+
+		if (streamerInitSuccess)
+		{
+			this->rowCount = this->chunkStreamer->GetRowCount();
+			this->columnCount = this->chunkStreamer->GetColumnCount();
+		}
+	}
+	else
+	{
+		//every layer is parsed in parallel, a malformed file leaves the map empty rather than half loaded
+		bool readDataSuccess = CsvMapLoader::Load(tileDataFilePathsByLayer, this->tilesetHandle, threadPool, this->tilesByLayer, this->rowCount, this->columnCount);
 
 #if _DEBUG
 		assert(readDataSuccess);
 #endif
+
+		if (!readDataSuccess)
+		{
+			this->rowCount = 0;
+			this->columnCount = 0;
+			this->numberOfLayers = 0;
+		}
+
+		this->buildWalkableBitmap();
 	}
 
-	this->texture = new Texture(textureFilepath);
-	bool loadSuccess = this->texture->Load();
+	//shared with every other map on this tileset, only decodes when built off the render thread, FinishLoading() does the upload and baking
+	this->texture = TextureCache::Acquire(TilesetRegistry::Get(this->tilesetHandle).imageFilePath);
 
 #if _DEBUG
-	assert(loadSuccess);
-	assert(tileInitSuccess);
+	assert(this->texture);
+#endif
+}
+
+Map::Map(const MapBundle& bundle, TilesetHandle tilesetHandle)
+{
+	const MapBundleHeader* header = bundle.GetHeader();
+	this->tilesetHandle = tilesetHandle;
+
+#if _DEBUG
+	assert(this->tilesetHandle != INVALID_TILESET_HANDLE);
+#endif
+	this->rowCount = header->rowCount;
+	this->columnCount = header->columnCount;
+	this->numberOfLayers = header->layerCount;
+
+	//the bundle already holds every layer as a flat array of ids, so this is a straight copy with no parsing
+	const Tileset& tileset = TilesetRegistry::Get(this->tilesetHandle);
+	const int layerTileCount = this->rowCount * this->columnCount;
+	this->tilesByLayer.resize(this->numberOfLayers);
+	for (int layer = 0; layer < this->numberOfLayers; layer++)
+	{
+		const uint16_t* tileIds = bundle.GetLayerTileIds(layer);
+		std::vector<MapTile>& mapTiles = this->tilesByLayer[layer];
+		mapTiles.reserve(layerTileCount);
+
+		for (int index = 0; index < layerTileCount; index++)
+		{
+			mapTiles.emplace_back(tileset, tileIds[index]);
+		}
+	}
+
+	this->buildWalkableBitmap();
+
+	//shared with every other map on this tileset, only decodes when built off the render thread, FinishLoading() does the upload and baking
+	this->texture = TextureCache::Acquire(TilesetRegistry::Get(this->tilesetHandle).imageFilePath);
+
+#if _DEBUG
+	assert(this->texture);
+#endif
+}
+
+Map::Map(TmxMapData& tmxData)
+{
+	//the loader already decoded every layer into our layout, so just take ownership of it
+	this->tilesetHandle = tmxData.tilesetHandle;
+	this->rowCount = tmxData.rowCount;
+	this->columnCount = tmxData.columnCount;
+	this->numberOfLayers = tmxData.tilesByLayer.size();
+	this->tilesByLayer = std::move(tmxData.tilesByLayer);
+
+	this->buildWalkableBitmap();
+
+	//shared with every other map on this tileset, only decodes when built off the render thread, FinishLoading() does the upload and baking
+	this->texture = TextureCache::Acquire(tmxData.textureFilePath);
+
+#if _DEBUG
+	assert(this->texture);
 #endif
 }
 
@@ -42,24 +137,19 @@ Map::Map(const std::vector<std::string>& tileDataFilePathsByLayer, const std::st
 
 Map::~Map()
 {
-	for (std::pair<int, std::vector<MapTile*>> mapLayer : this->mapTilesByLayer)
-	{
-		std::vector<MapTile*>& mapTiles = mapLayer.second;
+	this->releaseBakedChunks();
 
-		for (MapTile* tile : mapTiles)
-		{
-			delete tile;
-			tile = nullptr;
-		}
-		mapTiles.clear();
-	}
-	this->mapTilesByLayer.clear();
+	this->tilesByLayer.clear();
+	this->walkableBits.clear();
 
-	if (this->texture)
+	if (this->chunkStreamer)
 	{
-		delete this->texture;
-		this->texture = nullptr;
+		delete this->chunkStreamer;
+		this->chunkStreamer = nullptr;
 	}
+
+	TextureCache::Release(this->texture);
+	this->texture = nullptr;
 }
 
 void Map::Draw(int cameraShiftX, int cameraShiftY) const
@@ -67,21 +157,90 @@ void Map::Draw(int cameraShiftX, int cameraShiftY) const
 #if _DEBUG
 	assert(this->rowCount > 0);
 	assert(this->columnCount > 0);
-	assert(this->mapTilesByLayer.size() > 0);
+	assert(this->tilesByLayer.size() > 0 || this->chunkStreamer);
 	assert(this->texture);
 #endif
 
-	for (std::pair<int, std::vector<MapTile*>> mapLayer : this->mapTilesByLayer)
+	//only queue the tiles that overlap the camera view (plus a small margin)
+	const int firstColumn = std::max(0, Map::GetTileAt(cameraShiftX - DRAW_CULLING_MARGIN, TILE_WIDTH));
+	const int lastColumn = std::min(this->columnCount - 1, Map::GetTileAt(cameraShiftX + CAMERA_VIEW_WIDTH + DRAW_CULLING_MARGIN, TILE_WIDTH));
+	const int firstRow = std::max(0, Map::GetTileAt(cameraShiftY - DRAW_CULLING_MARGIN, TILE_HEIGHT));
+	const int lastRow = std::min(this->rowCount - 1, Map::GetTileAt(cameraShiftY + CAMERA_VIEW_HEIGHT + DRAW_CULLING_MARGIN, TILE_HEIGHT));
+
+	if (!this->bakedChunks.empty())
+	{
+		//a few pre-rendered chunk blits instead of one draw per tile, still layer by layer to keep the same draw order
+		const int firstChunkRow = firstRow / (MAP_BAKED_CHUNK_SIZE / TILE_HEIGHT);
+		const int lastChunkRow = lastRow / (MAP_BAKED_CHUNK_SIZE / TILE_HEIGHT);
+		const int firstChunkColumn = firstColumn / (MAP_BAKED_CHUNK_SIZE / TILE_WIDTH);
+		const int lastChunkColumn = lastColumn / (MAP_BAKED_CHUNK_SIZE / TILE_WIDTH);
+
+		for (int layer = 0; layer < this->numberOfLayers; layer++)
+		{
+			for (int chunkRow = firstChunkRow; chunkRow <= lastChunkRow; chunkRow++)
+			{
+				for (int chunkColumn = firstChunkColumn; chunkColumn <= lastChunkColumn; chunkColumn++)
+				{
+					const BakedChunk& bakedChunk = this->bakedChunks[this->getBakedChunkIndex(layer, chunkRow, chunkColumn)];
+					const int x = Map::GetTileStart(chunkColumn * (MAP_BAKED_CHUNK_SIZE / TILE_WIDTH), TILE_WIDTH) - cameraShiftX;
+					const int y = Map::GetTileStart(chunkRow * (MAP_BAKED_CHUNK_SIZE / TILE_HEIGHT), TILE_HEIGHT) - cameraShiftY;
+
+					if (bakedChunk.groundTexture)
+						Display::QueueTextureForRendering(bakedChunk.groundTexture, x, y, MAP_BAKED_CHUNK_SIZE, MAP_BAKED_CHUNK_SIZE, false, RenderLayers::GROUND);
+
+					if (bakedChunk.objectsTexture)
+						Display::QueueTextureForRendering(bakedChunk.objectsTexture, x, y, MAP_BAKED_CHUNK_SIZE, MAP_BAKED_CHUNK_SIZE, false, RenderLayers::OBJECTS);
+				}
+			}
+		}
+
+		return;
+	}
+
+	if (!this->chunkStreamer)
 	{
-		const std::vector<MapTile*>& mapTiles = mapLayer.second;
+		for (const std::vector<MapTile>& mapTiles : this->tilesByLayer)
+		{
+			this->drawTiles(mapTiles, 0, 0, this->columnCount, firstRow, firstColumn, lastRow, lastColumn, cameraShiftX, cameraShiftY);
+		}
+
+		return;
+	}
 
-		for (const MapTile* tile : mapTiles)
+	//streamed map, draw whatever part of the view is resident (layer by layer to keep the same draw order as above)
+	for (int layer = 0; layer < this->numberOfLayers; layer++)
+	{
+		for (int chunkRow = firstRow / MAP_CHUNK_SIZE; chunkRow <= lastRow / MAP_CHUNK_SIZE; chunkRow++)
 		{
-			tile->Draw(this->texture, cameraShiftX, cameraShiftY);
+			for (int chunkColumn = firstColumn / MAP_CHUNK_SIZE; chunkColumn <= lastColumn / MAP_CHUNK_SIZE; chunkColumn++)
+			{
+				const MapChunk* chunk = this->chunkStreamer->GetChunk(chunkRow, chunkColumn);
+				if (chunk == nullptr)
+					continue;
+
+				const int chunkFirstRow = chunkRow * MAP_CHUNK_SIZE;
+				const int chunkFirstColumn = chunkColumn * MAP_CHUNK_SIZE;
+
+				this->drawTiles(chunk->tilesByLayer[layer], chunkFirstRow, chunkFirstColumn, chunk->columnCount, std::max(firstRow, chunkFirstRow), std::max(firstColumn, chunkFirstColumn), std::min(lastRow, chunkFirstRow + chunk->rowCount - 1), std::min(lastColumn, chunkFirstColumn + chunk->columnCount - 1), cameraShiftX, cameraShiftY);
+			}
 		}
 	}
 }
 
+void Map::UpdateStreaming(int cameraShiftX, int cameraShiftY)
+{
+	if (!this->chunkStreamer)
+		return;
+
+	//keep the chunks under the camera view, plus a margin to load ahead of the player, resident
+	const int firstChunkColumn = std::max(0, Map::GetTileAt(cameraShiftX, TILE_WIDTH)) / MAP_CHUNK_SIZE - MAP_CHUNK_STREAMING_MARGIN;
+	const int lastChunkColumn = std::max(0, Map::GetTileAt(cameraShiftX + CAMERA_VIEW_WIDTH, TILE_WIDTH)) / MAP_CHUNK_SIZE + MAP_CHUNK_STREAMING_MARGIN;
+	const int firstChunkRow = std::max(0, Map::GetTileAt(cameraShiftY, TILE_HEIGHT)) / MAP_CHUNK_SIZE - MAP_CHUNK_STREAMING_MARGIN;
+	const int lastChunkRow = std::max(0, Map::GetTileAt(cameraShiftY + CAMERA_VIEW_HEIGHT, TILE_HEIGHT)) / MAP_CHUNK_SIZE + MAP_CHUNK_STREAMING_MARGIN;
+
+	this->chunkStreamer->Update(firstChunkRow, firstChunkColumn, lastChunkRow, lastChunkColumn);
+}
+
 int Map::GetRowCount() const
 {
 	return this->rowCount;
@@ -94,104 +253,413 @@ int Map::GetColumnCount() const
 
 int Map::GetNumberOfLayers() const
 {
-	return this->mapTilesByLayer.size();
+	return this->numberOfLayers;
+}
+
+bool Map::GetIsLoaded() const
+{
+	//a map whose data failed to load is left empty
+	return this->rowCount > 0 && this->columnCount > 0;
 }
 
 const MapTile* Map::GetTileByWorldGridLocation(int row, int column, int layer) const
 {
 #if _DEBUG
-	assert(layer >= 0 && layer < this->mapTilesByLayer.size());
+	assert(layer >= 0 && layer < this->numberOfLayers);
 #endif
 
-	for (const MapTile* tile : this->mapTilesByLayer.at(layer))
+	//off the edge of the map, callers treat this the same as a non-walkable tile
+	if (row < 0 || row >= this->rowCount || column < 0 || column >= this->columnCount)
+		return nullptr;
+
+	if (this->chunkStreamer)
+	{
+		//not streamed in yet is treated the same as off the edge
+		const MapChunk* chunk = this->chunkStreamer->GetChunk(row / MAP_CHUNK_SIZE, column / MAP_CHUNK_SIZE);
+		if (chunk == nullptr)
+			return nullptr;
+
+		return &chunk->tilesByLayer[layer][((row % MAP_CHUNK_SIZE) * chunk->columnCount) + (column % MAP_CHUNK_SIZE)];
+	}
+
+	return &this->tilesByLayer[layer][this->getTileIndex(row, column)];
+}
+
+bool Map::IsWalkable(int row, int column) const
+{
+	//off the edge of the map is never walkable
+	if (row < 0 || row >= this->rowCount || column < 0 || column >= this->columnCount)
+		return false;
+
+	if (this->chunkStreamer)
 	{
-		if (tile->GetWorldGridRow() == row && tile->GetWorldGridColumn() == column)
-			return tile;
+		//chunks that aren't resident yet are blocked until they stream in
+		const MapChunk* chunk = this->chunkStreamer->GetChunk(row / MAP_CHUNK_SIZE, column / MAP_CHUNK_SIZE);
+		if (chunk == nullptr)
+			return false;
+
+		const int chunkIndex = ((row % MAP_CHUNK_SIZE) * chunk->columnCount) + (column % MAP_CHUNK_SIZE);
+		return (chunk->walkableBits[chunkIndex / WALKABLE_BITS_PER_WORD] >> (chunkIndex % WALKABLE_BITS_PER_WORD)) & 1u;
 	}
 
+	const int index = this->getTileIndex(row, column);
+	return (this->walkableBits[index / WALKABLE_BITS_PER_WORD] >> (index % WALKABLE_BITS_PER_WORD)) & 1u;
+}
+
+bool Map::IsWalkableRect(int firstRow, int firstColumn, int lastRow, int lastColumn) const
+{
+	for (int row = firstRow; row <= lastRow; row++)
+	{
+		for (int column = firstColumn; column <= lastColumn; column++)
+		{
+			if (!this->IsWalkable(row, column))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void Map::SetTile(int row, int column, int layer, int id)
+{
+#if _DEBUG
+	assert(layer >= 0 && layer < this->numberOfLayers);
+	assert(row >= 0 && row < this->rowCount);
+	assert(column >= 0 && column < this->columnCount);
+#endif
+
+	if (id < 0)
+		id = DEFAULT_EMPTY_MAP_TILE_ID;
+
+	if (this->chunkStreamer)
+	{
+		MapChunk* chunk = this->chunkStreamer->GetChunkForEdit(row / MAP_CHUNK_SIZE, column / MAP_CHUNK_SIZE);
+
 #if _DEBUG
-	assert(false);	//we failed to find it!
+		assert(chunk);	//can only edit tiles that are streamed in
 #endif
 
-	return nullptr;
+		if (chunk == nullptr)
+			return;
+
+		const int chunkIndex = ((row % MAP_CHUNK_SIZE) * chunk->columnCount) + (column % MAP_CHUNK_SIZE);
+		chunk->tilesByLayer[layer][chunkIndex] = MapTile(TilesetRegistry::Get(this->tilesetHandle), id);
+
+		bool walkable = true;
+		for (const std::vector<MapTile>& mapTiles : chunk->tilesByLayer)
+		{
+			if (!mapTiles[chunkIndex].GetIsWalkable())
+			{
+				walkable = false;
+				break;
+			}
+		}
+
+		unsigned int& word = chunk->walkableBits[chunkIndex / WALKABLE_BITS_PER_WORD];
+		const unsigned int mask = 1u << (chunkIndex % WALKABLE_BITS_PER_WORD);
+		word = walkable ? (word | mask) : (word & ~mask);
+
+		return;
+	}
+
+	this->tilesByLayer[layer][this->getTileIndex(row, column)] = MapTile(TilesetRegistry::Get(this->tilesetHandle), id);
+
+	//only this one cell's merged walkability can have changed
+	this->updateWalkableBit(row, column);
+
+	//same goes for the baked chunk it sits in, if re-baking fails fall back to drawing tile by tile
+	if (!this->bakedChunks.empty() && !this->bakeChunk(layer, row / (MAP_BAKED_CHUNK_SIZE / TILE_HEIGHT), column / (MAP_BAKED_CHUNK_SIZE / TILE_WIDTH)))
+	{
+		this->releaseBakedChunks();
+	}
+}
+
+bool Map::GetIsStreamed() const
+{
+	return this->chunkStreamer != nullptr;
+}
+
+const MapChunkStreamingStats* Map::GetChunkStreamingStats() const
+{
+	if (!this->chunkStreamer)
+		return nullptr;
+
+	return &this->chunkStreamer->GetStats();
+}
+
+void Map::SetResidentChunkBudget(int budget)
+{
+	if (this->chunkStreamer)
+	{
+		this->chunkStreamer->SetResidentChunkBudget(budget);
+	}
+}
+
+bool Map::GetIsBaked() const
+{
+	return !this->bakedChunks.empty();
+}
+
+bool Map::FinishLoading()
+{
+	//everything that needs the renderer, so maps can be constructed on a background thread
+	if (!this->texture->Upload())
+		return false;
+
+	if (this->bakedChunks.empty())
+		this->bakeChunks();
+
+	return true;
+}
+
+void Map::RebakeChunks()
+{
+	//render target contents can be lost (e.g. on a Direct3D device reset), so redraw everything from the tiles
+	this->releaseBakedChunks();
+	this->bakeChunks();
+}
+
+size_t Map::GetByteCount() const
+{
+	//what keeping this map around costs: tiles, walkable bits, tileset texture and baked chunks
+	size_t byteCount = this->walkableBits.size() * sizeof(unsigned int);
+
+	for (const std::vector<MapTile>& mapTiles : this->tilesByLayer)
+	{
+		byteCount += mapTiles.size() * sizeof(MapTile);
+	}
+
+	if (this->texture)
+		byteCount += this->texture->GetByteCount();
+
+	for (const BakedChunk& bakedChunk : this->bakedChunks)
+	{
+		if (bakedChunk.groundTexture)
+			byteCount += bakedChunk.groundTexture->GetByteCount();
+
+		if (bakedChunk.objectsTexture)
+			byteCount += bakedChunk.objectsTexture->GetByteCount();
+	}
+
+	//streamed maps only hold their resident chunks
+	if (this->chunkStreamer)
+		byteCount += static_cast<size_t>(this->chunkStreamer->GetStats().residentChunks) * MAP_CHUNK_SIZE * MAP_CHUNK_SIZE * this->numberOfLayers * sizeof(MapTile);
+
+	return byteCount;
+}
+
+int Map::GetTileAt(double position, int tileSize)
+{
+	//floor rather than truncate, the half tile left of (or above) tile 0 is still on the map
+	return static_cast<int>(std::floor((position + (tileSize / 2)) / tileSize));
+}
+
+int Map::GetTileStart(int tile, int tileSize)
+{
+	return (tile * tileSize) - (tileSize / 2);
 }
 
 #pragma endregion
 
 #pragma region Private Methods
 
-bool Map::readDataFile(const std::string& tileDataFilepath, int layer)
+bool Map::shouldStreamDataFile(const std::string& tileDataFilepath) const
 {
-	std::ifstream file(tileDataFilepath.c_str());
+	//only need the size here, so don't read anything
+	std::ifstream file(tileDataFilepath.c_str(), std::ios::binary | std::ios::ate);
 
 	if (!file.is_open())
 		return false;
 
-	int fileRowCount = 0;
-	int fileColumnCount = 0;
-	std::vector<MapTile*> mapTiles;
+	return file.tellg() >= MAP_CHUNK_STREAMING_MIN_FILE_SIZE;
+}
 
-	std::string line;
-	while (std::getline(file, line))
-	{
-		if (line.length() == 0)
-			continue;
+int Map::getTileIndex(int row, int column) const
+{
+	return (row * this->columnCount) + column;
+}
 
-		fileColumnCount = 0;
+void Map::drawTiles(const std::vector<MapTile>& mapTiles, int tilesFirstRow, int tilesFirstColumn, int tilesColumnCount, int firstRow, int firstColumn, int lastRow, int lastColumn, int cameraShiftX, int cameraShiftY) const
+{
+	const Tileset& tileset = TilesetRegistry::Get(this->tilesetHandle);
+
+	this->groundTileCommands.clear();
+	this->objectsTileCommands.clear();
 
-		char* l = _strdup(line.c_str());
+	//mapTiles is a row-major grid whose top left tile sits at (tilesFirstRow, tilesFirstColumn) in the world
+	for (int row = firstRow; row <= lastRow; row++)
+	{
+		const int rowStart = (row - tilesFirstRow) * tilesColumnCount - tilesFirstColumn;
+		const int y = Map::GetTileStart(row, TILE_HEIGHT) - cameraShiftY;
 
-		char* context = NULL;
-		char* token = strtok_s(l, ",", &context);
-		while (token != NULL)
+		for (int column = firstColumn; column <= lastColumn; column++)
 		{
-			int id = atoi(token);
-			
-			if (id < 0)
-				id = DEFAULT_EMPTY_MAP_TILE_ID;
+			const MapTile& mapTile = mapTiles[rowStart + column];
+			std::vector<TileDrawCommand>& commands = mapTile.GetIsObject() ? this->objectsTileCommands : this->groundTileCommands;
+			commands.push_back({ Map::GetTileStart(column, TILE_WIDTH) - cameraShiftX, y, mapTile.GetId() });
+		}
+	}
 
-			MapTile* tile = new MapTile(tileDataFilepath, id, fileRowCount, fileColumnCount);
-			mapTiles.push_back(tile);
+	//tiles within one layer never overlap, so splitting them by render layer (for opacity) doesn't change what ends up on screen
+	Display::QueueTilesForRendering(this->texture, tileset.sourceRects.data(), this->groundTileCommands.data(), this->groundTileCommands.size(), RenderLayers::GROUND);
+	Display::QueueTilesForRendering(this->texture, tileset.sourceRects.data(), this->objectsTileCommands.data(), this->objectsTileCommands.size(), RenderLayers::OBJECTS);
+}
 
-			token = strtok_s(NULL, ",", &context);
-			fileColumnCount++;
-		}
+void Map::buildWalkableBitmap()
+{
+	const int cellCount = this->rowCount * this->columnCount;
+	this->walkableBits.assign((cellCount + WALKABLE_BITS_PER_WORD - 1) / WALKABLE_BITS_PER_WORD, 0u);
 
-		free(l);
-		fileRowCount++;
+	for (int row = 0; row < this->rowCount; row++)
+	{
+		for (int column = 0; column < this->columnCount; column++)
+		{
+			this->updateWalkableBit(row, column);
+		}
 	}
+}
 
-	file.close();
-
-#if _DEBUG
-	assert(mapTiles.size() == (fileRowCount * fileColumnCount));
-#endif
+void Map::updateWalkableBit(int row, int column)
+{
+	const int index = this->getTileIndex(row, column);
 
-	if (this->rowCount == 0)
+	//each layer of the map has different walkable data, the cell is only walkable if all of them agree
+	bool walkable = true;
+	for (const std::vector<MapTile>& mapTiles : this->tilesByLayer)
 	{
-		this->rowCount = fileRowCount;
+		if (!mapTiles[index].GetIsWalkable())
+		{
+			walkable = false;
+			break;
+		}
 	}
+
+	unsigned int& word = this->walkableBits[index / WALKABLE_BITS_PER_WORD];
+	const unsigned int mask = 1u << (index % WALKABLE_BITS_PER_WORD);
+
+	if (walkable)
+		word |= mask;
 	else
+		word &= ~mask;
+}
+
+void Map::bakeChunks()
+{
+#if MAP_BAKE_STATIC_LAYERS
+	//streamed maps keep changing what's resident, so they're always drawn tile by tile, as is everything when there's no renderer at all
+	if (this->chunkStreamer || Display::GetIsHeadless() || !SDL_RenderTargetSupported(Display::GetRenderer()))
+		return;
+
+	const int chunkTileRowCount = MAP_BAKED_CHUNK_SIZE / TILE_HEIGHT;
+	const int chunkTileColumnCount = MAP_BAKED_CHUNK_SIZE / TILE_WIDTH;
+
+	this->bakedChunkRowCount = (this->rowCount + chunkTileRowCount - 1) / chunkTileRowCount;
+	this->bakedChunkColumnCount = (this->columnCount + chunkTileColumnCount - 1) / chunkTileColumnCount;
+	this->bakedChunks.resize(this->numberOfLayers * this->bakedChunkRowCount * this->bakedChunkColumnCount);
+
+	for (int layer = 0; layer < this->numberOfLayers; layer++)
 	{
-#if _DEBUG
-		assert(this->rowCount == fileRowCount);
-#endif
+		for (int chunkRow = 0; chunkRow < this->bakedChunkRowCount; chunkRow++)
+		{
+			for (int chunkColumn = 0; chunkColumn < this->bakedChunkColumnCount; chunkColumn++)
+			{
+				if (!this->bakeChunk(layer, chunkRow, chunkColumn))
+				{
+					//couldn't get a render target, draw tile by tile like before
+					this->releaseBakedChunks();
+					return;
+				}
+			}
+		}
 	}
+#endif
+}
+
+bool Map::bakeChunk(int layer, int chunkRow, int chunkColumn)
+{
+	BakedChunk& bakedChunk = this->bakedChunks[this->getBakedChunkIndex(layer, chunkRow, chunkColumn)];
+	const std::vector<MapTile>& mapTiles = this->tilesByLayer[layer];
+	const Tileset& tileset = TilesetRegistry::Get(this->tilesetHandle);
+
+	const int firstRow = chunkRow * (MAP_BAKED_CHUNK_SIZE / TILE_HEIGHT);
+	const int lastRow = std::min(this->rowCount, firstRow + (MAP_BAKED_CHUNK_SIZE / TILE_HEIGHT)) - 1;
+	const int firstColumn = chunkColumn * (MAP_BAKED_CHUNK_SIZE / TILE_WIDTH);
+	const int lastColumn = std::min(this->columnCount, firstColumn + (MAP_BAKED_CHUNK_SIZE / TILE_WIDTH)) - 1;
+
+	//Display sets the tileset's alpha per layer while drawing, bake at full opacity and let the chunk textures carry the layer opacity instead
+	this->texture->SetOpacity(255);
 
-	if (this->columnCount == 0)
+	for (int pass = 0; pass < 2; pass++)
 	{
-		this->columnCount = fileColumnCount;
+		const bool bakeObjects = (pass == 1);
+		Texture*& bakedTexture = bakeObjects ? bakedChunk.objectsTexture : bakedChunk.groundTexture;
+
+		bool hasTiles = false;
+		for (int row = firstRow; row <= lastRow && !hasTiles; row++)
+		{
+			for (int column = firstColumn; column <= lastColumn; column++)
+			{
+				if (mapTiles[this->getTileIndex(row, column)].GetIsObject() == bakeObjects)
+				{
+					hasTiles = true;
+					break;
+				}
+			}
+		}
+
+		//nothing on this render layer here, don't keep an empty texture around
+		if (!hasTiles)
+		{
+			delete bakedTexture;
+			bakedTexture = nullptr;
+			continue;
+		}
+
+		if (!bakedTexture)
+		{
+			bakedTexture = Texture::CreateRenderTarget(MAP_BAKED_CHUNK_SIZE, MAP_BAKED_CHUNK_SIZE);
+
+			if (!bakedTexture)
+				return false;
+		}
+
+		if (!bakedTexture->BeginRenderTarget())
+			return false;
+
+		for (int row = firstRow; row <= lastRow; row++)
+		{
+			for (int column = firstColumn; column <= lastColumn; column++)
+			{
+				const MapTile& mapTile = mapTiles[this->getTileIndex(row, column)];
+				if (mapTile.GetIsObject() == bakeObjects)
+				{
+					mapTile.DrawImmediate(this->texture, tileset, (column - firstColumn) * TILE_WIDTH, (row - firstRow) * TILE_HEIGHT);
+				}
+			}
+		}
+
+		Texture::EndRenderTarget();
 	}
-	else
+
+	return true;
+}
+
+void Map::releaseBakedChunks()
+{
+	for (BakedChunk& bakedChunk : this->bakedChunks)
 	{
-#if _DEBUG
-		assert(this->columnCount == fileColumnCount);
-#endif
+		delete bakedChunk.groundTexture;
+		delete bakedChunk.objectsTexture;
 	}
 
-	this->mapTilesByLayer.insert(std::make_pair(layer, mapTiles));
+	this->bakedChunks.clear();
+	this->bakedChunkRowCount = 0;
+	this->bakedChunkColumnCount = 0;
+}
 
-	return true;
+int Map::getBakedChunkIndex(int layer, int chunkRow, int chunkColumn) const
+{
+	return (((layer * this->bakedChunkRowCount) + chunkRow) * this->bakedChunkColumnCount) + chunkColumn;
 }
 
-#pragma endregion
+#pragma endregion
\ No newline at end of file
@@ -1,32 +1,84 @@
 #pragma once
 
+#include "MapTile.h"
 #include <string>
 #include <vector>
-#include <map>
 
 #pragma region Forward Declarations
 class Texture;
-class MapTile;
+class MapBundle;
+class MapChunkStreamer;
+class ThreadPool;
+struct TileDrawCommand;
+struct TmxMapData;
+struct MapChunkStreamingStats;
 #pragma endregion
 
 class Map
 {
 public:
-	Map(const std::vector<std::string>& tileDataFilePathsByLayer, const std::string& textureFilepath);
+	Map(const std::vector<std::string>& tileDataFilePathsByLayer, TilesetHandle tilesetHandle, ThreadPool* threadPool);
+	Map(const MapBundle& bundle, TilesetHandle tilesetHandle);
+	Map(TmxMapData& tmxData);
 	~Map();
 
 	void Draw(int cameraShiftX, int cameraShiftY) const;
+	void UpdateStreaming(int cameraShiftX, int cameraShiftY);
 
 	int GetRowCount() const;
 	int GetColumnCount() const;
 	int GetNumberOfLayers() const;
+	bool GetIsLoaded() const;
 	const MapTile* GetTileByWorldGridLocation(int row, int column, int layer) const;
 
+	bool IsWalkable(int row, int column) const;
+	bool IsWalkableRect(int firstRow, int firstColumn, int lastRow, int lastColumn) const;
+
+	void SetTile(int row, int column, int layer, int id);
+
+	bool GetIsStreamed() const;
+	const MapChunkStreamingStats* GetChunkStreamingStats() const;
+	void SetResidentChunkBudget(int budget);
+
+	bool FinishLoading();
+	bool GetIsBaked() const;
+	void RebakeChunks();
+
+	size_t GetByteCount() const;
+
+	//tile n (row or column) is drawn centred on n * tileSize, so it covers [n * tileSize - tileSize / 2, n * tileSize + tileSize / 2), every tile <-> world conversion goes through these
+	static int GetTileAt(double position, int tileSize);
+	static int GetTileStart(int tile, int tileSize);
+
 private:
-	bool readDataFile(const std::string& tileDataFilepath, int layer);
+	//one map layer's tiles inside a MAP_BAKED_CHUNK_SIZE square, pre-rendered once per render layer so each keeps its own opacity
+	struct BakedChunk
+	{
+		Texture* groundTexture = nullptr;
+		Texture* objectsTexture = nullptr;
+	};
+
+	bool shouldStreamDataFile(const std::string& tileDataFilepath) const;
+	int getTileIndex(int row, int column) const;
+	void drawTiles(const std::vector<MapTile>& mapTiles, int tilesFirstRow, int tilesFirstColumn, int tilesColumnCount, int firstRow, int firstColumn, int lastRow, int lastColumn, int cameraShiftX, int cameraShiftY) const;
+	void buildWalkableBitmap();
+	void updateWalkableBit(int row, int column);
+	void bakeChunks();
+	bool bakeChunk(int layer, int chunkRow, int chunkColumn);
+	void releaseBakedChunks();
+	int getBakedChunkIndex(int layer, int chunkRow, int chunkColumn) const;
 
 	int rowCount = 0;
 	int columnCount = 0;
+	TilesetHandle tilesetHandle = INVALID_TILESET_HANDLE;
+	int numberOfLayers = 0;
 	Texture* texture = nullptr;
-	std::map<int, std::vector<MapTile*>> mapTilesByLayer;
+	std::vector<std::vector<MapTile>> tilesByLayer;		//one dense row-major grid per layer, indexed by getTileIndex()
+	std::vector<unsigned int> walkableBits;				//one bit per cell (same indexing), set only if the cell is walkable on every layer
+	MapChunkStreamer* chunkStreamer = nullptr;			//only set for maps too big to load up front, tilesByLayer and walkableBits stay empty then
+	std::vector<BakedChunk> bakedChunks;				//empty unless baking is enabled and supported, indexed by getBakedChunkIndex()
+	int bakedChunkRowCount = 0;
+	int bakedChunkColumnCount = 0;
+	mutable std::vector<TileDrawCommand> groundTileCommands;	//scratch buffers for drawTiles(), kept around so drawing doesn't allocate every frame
+	mutable std::vector<TileDrawCommand> objectsTileCommands;
 };
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include "MapArena.h"
+#include <algorithm>
+#include <stdlib.h>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Constructor
+
+MapArena::MapArena(size_t blockSize)
+	: blockSize(blockSize)
+{
+#if _DEBUG
+	assert(blockSize > 0);
+#endif
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+MapArena::~MapArena()
+{
+	this->Release();
+}
+
+void* MapArena::Allocate(size_t size, size_t alignment)
+{
+#if _DEBUG
+	assert(alignment > 0 && (alignment & (alignment - 1)) == 0);	//power of two
+#endif
+
+	this->stats.allocations++;
+
+	if (size == 0)
+		size = 1;
+
+	//round up to the alignment within the newest block, or start a new one if it doesn't fit
+	if (!this->blocks.empty())
+	{
+		const Block& block = this->blocks.back();
+		const size_t alignedOffset = (this->blockOffset + alignment - 1) & ~(alignment - 1);
+
+		if (alignedOffset + size <= block.size)
+		{
+			this->blockOffset = alignedOffset + size;
+			this->stats.bytesUsed += size;
+			return block.memory + alignedOffset;
+		}
+	}
+
+	//oversized requests get a block of their own, malloc's alignment covers anything we store
+	this->addBlock(size + alignment);
+
+	const Block& block = this->blocks.back();
+	const size_t alignedOffset = (reinterpret_cast<size_t>(block.memory) + alignment - 1) & ~(alignment - 1);
+	const size_t offset = alignedOffset - reinterpret_cast<size_t>(block.memory);
+
+	this->blockOffset = offset + size;
+	this->stats.bytesUsed += size;
+	return block.memory + offset;
+}
+
+void MapArena::Release()
+{
+	//one free per block, however many things were allocated in them
+	for (Block& block : this->blocks)
+	{
+		free(block.memory);
+	}
+
+	this->blocks.clear();
+	this->blockOffset = 0;
+	this->stats.bytesUsed = 0;
+	this->stats.bytesReserved = 0;
+}
+
+const MapArenaStats& MapArena::GetStats() const
+{
+	return this->stats;
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+void MapArena::addBlock(size_t minimumSize)
+{
+	const size_t size = std::max(this->blockSize, minimumSize);
+
+	char* memory = static_cast<char*>(malloc(size));
+
+#if _DEBUG
+	assert(memory);
+#endif
+
+	this->blocks.push_back({ memory, size });
+	this->blockOffset = 0;
+	this->stats.blockAllocations++;
+	this->stats.bytesReserved += size;
+}
+
+#pragma endregion
\ No newline at end of file
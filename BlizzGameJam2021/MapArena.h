@@ -0,0 +1,92 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+struct MapArenaStats
+{
+	unsigned int blockAllocations;		//calls to the system allocator, this is what a map switch actually costs
+	unsigned int allocations;			//calls to Allocate(), each is just a pointer bump
+	size_t bytesUsed;
+	size_t bytesReserved;
+};
+
+//monotonic bump allocator owning everything a map's containers allocate, nothing is freed until Release() drops it all in one go
+class MapArena
+{
+public:
+	MapArena(size_t blockSize);
+	~MapArena();
+
+	void* Allocate(size_t size, size_t alignment);
+	void Release();
+
+	const MapArenaStats& GetStats() const;
+
+private:
+	struct Block
+	{
+		char* memory;
+		size_t size;
+	};
+
+	void addBlock(size_t minimumSize);
+
+	const size_t blockSize;
+	std::vector<Block> blocks;
+	size_t blockOffset = 0;		//how much of the newest block is handed out
+	MapArenaStats stats = {};
+};
+
+//lets std containers draw from a MapArena, deallocate() is a no-op since the arena frees everything at once
+template<typename T>
+class ArenaAllocator
+{
+public:
+	typedef T value_type;
+
+	ArenaAllocator(MapArena* arena)
+		: arena(arena)
+	{
+	}
+
+	template<typename U>
+	ArenaAllocator(const ArenaAllocator<U>& other)
+		: arena(other.GetArena())
+	{
+	}
+
+	T* allocate(size_t count)
+	{
+		return static_cast<T*>(this->arena->Allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	//nothing to do, the arena frees everything at once when it's reset
+	void deallocate(T*, size_t)
+	{
+	}
+
+	MapArena* GetArena() const
+	{
+		return this->arena;
+	}
+
+	template<typename U>
+	bool operator==(const ArenaAllocator<U>& other) const
+	{
+		return this->arena == other.GetArena();
+	}
+
+	template<typename U>
+	bool operator!=(const ArenaAllocator<U>& other) const
+	{
+		return this->arena != other.GetArena();
+	}
+
+private:
+	MapArena* arena;
+};
+
+//a std::vector whose storage lives in a MapArena
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
\ No newline at end of file
@@ -0,0 +1,388 @@
+#include "MapBundle.h"
+#include "CsvMapLoader.h"
+#include "MapRegistry.h"
+#include "Teleporter.h"
+#include "EntityStore.h"
+#include "TilesetRegistry.h"
+#include <fstream>
+#include <cstring>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#define MAP_BUNDLE_SECTION_ALIGNMENT	8
+#define MAP_BUNDLE_FNV_OFFSET_BASIS		14695981039346656037ull
+#define MAP_BUNDLE_FNV_PRIME			1099511628211ull
+
+//callers check the length first, records are zeroed so the copy stays null terminated
+static void copyPath(char* destination, const std::string& path)
+{
+	memcpy(destination, path.c_str(), path.length());
+}
+
+#pragma region Constructor
+
+MapBundle::MapBundle(const std::string& filepath)
+	: filepath(filepath)
+{
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+MapBundle::~MapBundle()
+{
+	this->Close();
+}
+
+bool MapBundle::Open(const MapDefinition& definition)
+{
+	if (this->data)
+		return true;
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(this->filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	this->fileHandle = file;
+	this->mappingHandle = mapping;
+	this->data = static_cast<const unsigned char*>(view);
+	this->size = static_cast<size_t>(fileSize.QuadPart);
+#else
+	int file = open(this->filepath.c_str(), O_RDONLY);
+	if (file < 0)
+		return false;
+
+	struct stat fileStat;
+	if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0)
+	{
+		close(file);
+		return false;
+	}
+
+	void* view = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+	if (view == MAP_FAILED)
+	{
+		close(file);
+		return false;
+	}
+
+	this->fileDescriptor = file;
+	this->data = static_cast<const unsigned char*>(view);
+	this->size = static_cast<size_t>(fileStat.st_size);
+#endif
+
+	if (!this->validate(TilesetRegistry::Get(definition.tilesetHandle)))
+	{
+		printf("Map bundle %s is invalid or was built by a different version, ignoring it\n", this->filepath.c_str());
+		this->Close();
+		return false;
+	}
+
+	//someone edited the .csv files since the bundle was built, they win
+	uint64_t sourceStamp = 0;
+	if (!MapBundle::getSourceStamp(definition, sourceStamp) || sourceStamp != this->GetHeader()->sourceStamp)
+	{
+		printf("Map bundle %s is out of date with the files it was built from, ignoring it\n", this->filepath.c_str());
+		this->Close();
+		return false;
+	}
+
+	return true;
+}
+
+void MapBundle::Close()
+{
+	if (!this->data)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(this->data);
+	CloseHandle(this->mappingHandle);
+	CloseHandle(this->fileHandle);
+	this->mappingHandle = nullptr;
+	this->fileHandle = nullptr;
+#else
+	munmap(const_cast<unsigned char*>(this->data), this->size);
+	close(this->fileDescriptor);
+	this->fileDescriptor = -1;
+#endif
+
+	this->data = nullptr;
+	this->size = 0;
+}
+
+const MapBundleHeader* MapBundle::GetHeader() const
+{
+	return reinterpret_cast<const MapBundleHeader*>(this->data);
+}
+
+const uint16_t* MapBundle::GetLayerTileIds(int layer) const
+{
+	const MapBundleHeader* header = this->GetHeader();
+
+#if _DEBUG
+	assert(layer >= 0 && layer < header->layerCount);
+#endif
+
+	const size_t layerTileCount = static_cast<size_t>(header->rowCount) * header->columnCount;
+	return reinterpret_cast<const uint16_t*>(this->data + header->layersOffset) + (layer * layerTileCount);
+}
+
+const MapBundleTeleporterRecord* MapBundle::GetTeleporters() const
+{
+	return reinterpret_cast<const MapBundleTeleporterRecord*>(this->data + this->GetHeader()->teleportersOffset);
+}
+
+const MapBundleSpawnRecord* MapBundle::GetSpawns() const
+{
+	return reinterpret_cast<const MapBundleSpawnRecord*>(this->data + this->GetHeader()->spawnsOffset);
+}
+
+bool MapBundle::Compile(const MapDefinition& definition, const std::string& outputFilePath, ThreadPool* threadPool)
+{
+	if (definition.isTmx)
+	{
+		printf("Map %s is a .tmx map, only .csv maps are compiled into bundles\n", definition.name.c_str());
+		return false;
+	}
+
+	const std::vector<std::string>& tileDataFilePathsByLayer = definition.mapFilePathsByLayer;
+	const std::string& teleportersFilePath = definition.teleportersFilePath;
+	const std::string& spawnsFilePath = definition.spawnsFilePath;
+
+	const int layerCount = tileDataFilePathsByLayer.size();
+	if (layerCount == 0 || layerCount > MAP_BUNDLE_MAX_LAYERS)
+	{
+		printf("Map bundles support 1 to %d layers, got %d\n", MAP_BUNDLE_MAX_LAYERS, layerCount);
+		return false;
+	}
+
+	MapBundleHeader header = {};
+	header.magic = MAP_BUNDLE_MAGIC;
+	header.version = MAP_BUNDLE_VERSION;
+	header.layerCount = layerCount;
+
+	if (!MapBundle::getSourceStamp(definition, header.sourceStamp))
+	{
+		printf("Unable to read the source files of map %s\n", definition.name.c_str());
+		return false;
+	}
+
+	//layers, parsed and checked against the tileset the same way the game loads them
+	std::vector<std::vector<MapTile>> tilesByLayer;
+	if (!CsvMapLoader::Load(tileDataFilePathsByLayer, definition.tilesetHandle, threadPool, tilesByLayer, header.rowCount, header.columnCount))
+		return false;
+
+	//MapTile ids are unsigned shorts already, so they always fit
+	std::vector<uint16_t> tileIds;
+	tileIds.reserve(tilesByLayer.size() * tilesByLayer.at(0).size());
+	for (const std::vector<MapTile>& mapTiles : tilesByLayer)
+	{
+		for (const MapTile& mapTile : mapTiles)
+		{
+			tileIds.push_back(static_cast<uint16_t>(mapTile.GetId()));
+		}
+	}
+
+	//teleporters
+	std::vector<Teleporter> teleporters;
+	if (!Teleporter::ReadFile(teleportersFilePath, teleporters))
+	{
+		printf("Unable to read teleporters %s\n", teleportersFilePath.c_str());
+		return false;
+	}
+
+	std::vector<MapBundleTeleporterRecord> teleporterRecords;
+	for (const Teleporter& teleporter : teleporters)
+	{
+		const Destination& destination = teleporter.GetDestination();
+
+		MapBundleTeleporterRecord record = {};
+		record.x = teleporter.GetX();
+		record.y = teleporter.GetY();
+		record.destinationX = destination.destinationX;
+		record.destinationY = destination.destinationY;
+
+		const std::string& destinationMapName = MapRegistry::Get(destination.destinationMap).name;
+		if (destinationMapName.length() >= MAP_BUNDLE_NAME_LENGTH)
+		{
+			printf("Teleporter at (%d, %d) in %s has a destination name that doesn't fit in a map bundle\n", record.x, record.y, teleportersFilePath.c_str());
+			return false;
+		}
+
+		copyPath(record.destinationMapName, destinationMapName);
+
+		teleporterRecords.push_back(record);
+	}
+
+	//spawns
+	std::vector<SpawnDefinition> spawns;
+	if (!EntityStore::ReadDefinitionsFile(spawnsFilePath, spawns))
+	{
+		printf("Unable to read spawns %s\n", spawnsFilePath.c_str());
+		return false;
+	}
+
+	std::vector<MapBundleSpawnRecord> spawnRecords;
+	for (const SpawnDefinition& spawn : spawns)
+	{
+		if (spawn.texturePath.length() >= MAP_BUNDLE_PATH_LENGTH)
+		{
+			printf("Spawn %d in %s has a texture path that doesn't fit in a map bundle\n", spawn.id, spawnsFilePath.c_str());
+			return false;
+		}
+
+		MapBundleSpawnRecord record = {};
+		record.id = spawn.id;
+		record.spawnX = static_cast<float>(spawn.spawnX);
+		record.spawnY = static_cast<float>(spawn.spawnY);
+		record.width = spawn.width;
+		record.height = spawn.height;
+		record.spriteSheetOffsetX = spawn.spriteSheetOffsetX;
+		record.spriteSheetOffsetY = spawn.spriteSheetOffsetY;
+		record.shouldIdleMove = spawn.shouldIdleMove ? 1 : 0;
+		record.isEnemy = spawn.isEnemy ? 1 : 0;
+		copyPath(record.texturePath, spawn.texturePath);
+
+		spawnRecords.push_back(record);
+	}
+
+	header.teleporterCount = teleporterRecords.size();
+	header.spawnCount = spawnRecords.size();
+
+	//lay the sections out back to back, each aligned so they can be read in place once mapped
+	const auto align = [](size_t offset) { return (offset + MAP_BUNDLE_SECTION_ALIGNMENT - 1) & ~static_cast<size_t>(MAP_BUNDLE_SECTION_ALIGNMENT - 1); };
+
+	header.layersOffset = align(sizeof(MapBundleHeader));
+	header.teleportersOffset = align(header.layersOffset + tileIds.size() * sizeof(uint16_t));
+	header.spawnsOffset = align(header.teleportersOffset + teleporterRecords.size() * sizeof(MapBundleTeleporterRecord));
+	header.fileSize = align(header.spawnsOffset + spawnRecords.size() * sizeof(MapBundleSpawnRecord));
+
+	std::vector<unsigned char> output(header.fileSize, 0);
+	memcpy(output.data(), &header, sizeof(MapBundleHeader));
+	if (!tileIds.empty())
+		memcpy(output.data() + header.layersOffset, tileIds.data(), tileIds.size() * sizeof(uint16_t));
+	if (!teleporterRecords.empty())
+		memcpy(output.data() + header.teleportersOffset, teleporterRecords.data(), teleporterRecords.size() * sizeof(MapBundleTeleporterRecord));
+	if (!spawnRecords.empty())
+		memcpy(output.data() + header.spawnsOffset, spawnRecords.data(), spawnRecords.size() * sizeof(MapBundleSpawnRecord));
+
+	std::ofstream file(outputFilePath.c_str(), std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		printf("Unable to write map bundle %s\n", outputFilePath.c_str());
+		return false;
+	}
+
+	file.write(reinterpret_cast<const char*>(output.data()), output.size());
+	file.close();
+
+	return !file.fail();
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+bool MapBundle::validate(const Tileset& tileset) const
+{
+	if (this->size < sizeof(MapBundleHeader))
+		return false;
+
+	const MapBundleHeader* header = this->GetHeader();
+
+	if (header->magic != MAP_BUNDLE_MAGIC || header->version != MAP_BUNDLE_VERSION || header->fileSize != this->size)
+		return false;
+
+	if (header->rowCount <= 0 || header->columnCount <= 0 || header->layerCount <= 0 || header->layerCount > MAP_BUNDLE_MAX_LAYERS || header->teleporterCount < 0 || header->spawnCount < 0)
+		return false;
+
+	//every section has to fit inside the file
+	const unsigned long long layersSize = static_cast<unsigned long long>(header->rowCount) * header->columnCount * header->layerCount * sizeof(uint16_t);
+	const unsigned long long teleportersSize = static_cast<unsigned long long>(header->teleporterCount) * sizeof(MapBundleTeleporterRecord);
+	const unsigned long long spawnsSize = static_cast<unsigned long long>(header->spawnCount) * sizeof(MapBundleSpawnRecord);
+
+	if (header->layersOffset + layersSize > this->size)
+		return false;
+
+	if (header->teleportersOffset + teleportersSize > this->size)
+		return false;
+
+	if (header->spawnsOffset + spawnsSize > this->size)
+		return false;
+
+	//Map indexes the tileset's arrays by these without checking, same as CsvMapLoader rejects them
+	const uint16_t* tileIds = reinterpret_cast<const uint16_t*>(this->data + header->layersOffset);
+	const size_t tileIdCount = static_cast<size_t>(header->rowCount) * header->columnCount * header->layerCount;
+	for (size_t i = 0; i < tileIdCount; i++)
+	{
+		if (tileIds[i] >= tileset.tileCount)
+			return false;
+	}
+
+	return true;
+}
+
+bool MapBundle::getSourceStamp(const MapDefinition& definition, uint64_t& sourceStamp)
+{
+	//size and modified time rather than the contents, so checking it costs a few stats instead of reading everything the bundle replaces
+	std::vector<std::string> sourceFilePaths = definition.mapFilePathsByLayer;
+	sourceFilePaths.push_back(definition.teleportersFilePath);
+	sourceFilePaths.push_back(definition.spawnsFilePath);
+
+	sourceStamp = MAP_BUNDLE_FNV_OFFSET_BASIS;
+	for (const std::string& sourceFilePath : sourceFilePaths)
+	{
+		struct stat fileStat;
+		if (stat(sourceFilePath.c_str(), &fileStat) != 0)
+			return false;
+
+		const uint64_t values[2] = { static_cast<uint64_t>(fileStat.st_size), static_cast<uint64_t>(fileStat.st_mtime) };
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(values);
+		for (size_t i = 0; i < sizeof(values); i++)
+		{
+			sourceStamp = (sourceStamp ^ bytes[i]) * MAP_BUNDLE_FNV_PRIME;
+		}
+	}
+
+	return true;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#pragma region Forward Declarations
+struct MapDefinition;
+struct Tileset;
+class ThreadPool;
+#pragma endregion
+
+#define MAP_BUNDLE_MAGIC				0x4D4A4742		//"BGJM"
+#define MAP_BUNDLE_VERSION				3
+#define MAP_BUNDLE_FILE_EXTENSION		".bgjmap"
+#define MAP_BUNDLE_MAX_LAYERS			4
+#define MAP_BUNDLE_PATH_LENGTH			128
+#define MAP_BUNDLE_NAME_LENGTH			64
+
+//everything below is written to disk as-is, only append fields (and bump MAP_BUNDLE_VERSION) when changing them
+
+struct MapBundleHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t fileSize;
+	int32_t rowCount;
+	int32_t columnCount;
+	int32_t layerCount;
+	int32_t teleporterCount;
+	int32_t spawnCount;
+	uint32_t layersOffset;			//layerCount arrays of rowCount * columnCount tile ids, row-major
+	uint32_t teleportersOffset;
+	uint32_t spawnsOffset;
+	uint64_t sourceStamp;			//hash of the size and modified time of every file the bundle was built from, see MapBundle::getSourceStamp()
+};
+
+struct MapBundleTeleporterRecord
+{
+	int32_t x;
+	int32_t y;
+	int32_t destinationX;
+	int32_t destinationY;
+	char destinationMapName[MAP_BUNDLE_NAME_LENGTH];		//manifest name, handles aren't stable across manifest edits
+};
+
+struct MapBundleSpawnRecord
+{
+	int32_t id;
+	float spawnX;
+	float spawnY;
+	int32_t width;
+	int32_t height;
+	int32_t spriteSheetOffsetX;
+	int32_t spriteSheetOffsetY;
+	uint8_t shouldIdleMove;
+	uint8_t isEnemy;
+	uint8_t padding[2];
+	char texturePath[MAP_BUNDLE_PATH_LENGTH];
+};
+
+//read-only, memory mapped view of a compiled map (see MapBundle::Compile)
+class MapBundle
+{
+public:
+	MapBundle(const std::string& filepath);
+	~MapBundle();
+
+	bool Open(const MapDefinition& definition);
+	void Close();
+
+	const MapBundleHeader* GetHeader() const;
+	const uint16_t* GetLayerTileIds(int layer) const;
+	const MapBundleTeleporterRecord* GetTeleporters() const;
+	const MapBundleSpawnRecord* GetSpawns() const;
+
+	static bool Compile(const MapDefinition& definition, const std::string& outputFilePath, ThreadPool* threadPool);
+
+private:
+	bool validate(const Tileset& tileset) const;
+
+	static bool getSourceStamp(const MapDefinition& definition, uint64_t& sourceStamp);
+
+	std::string filepath;
+	const unsigned char* data = nullptr;
+	size_t size = 0;
+
+#ifdef _WIN32
+	void* fileHandle = nullptr;
+	void* mappingHandle = nullptr;
+#else
+	int fileDescriptor = -1;
+#endif
+};
\ No newline at end of file
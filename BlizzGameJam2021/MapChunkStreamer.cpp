@@ -0,0 +1,438 @@
+#include "MapChunkStreamer.h"
+#include "CsvMapLoader.h"
+#include "ThreadPool.h"
+#include "Constants.h"
+#include <algorithm>
+#include <cctype>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#define WALKABLE_BITS_PER_WORD 32
+
+#pragma region Constructor
+
+MapChunkStreamer::MapChunkStreamer(const std::vector<std::string>& tileDataFilePathsByLayer, TilesetHandle tilesetHandle, int residentChunkBudget)
+	: tileDataFilePathsByLayer(tileDataFilePathsByLayer), tileset(&TilesetRegistry::Get(tilesetHandle)), residentChunkBudget(residentChunkBudget)
+{
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+MapChunkStreamer::~MapChunkStreamer()
+{
+	//stop the worker before freeing anything it could still be handing back
+	{
+		std::lock_guard<std::mutex> lock(this->queueMutex);
+		this->stopRequested = true;
+		this->requestQueue.clear();
+	}
+	this->queueCondition.notify_all();
+
+	if (this->worker.joinable())
+		this->worker.join();
+
+	for (MapChunk* chunk : this->completedChunks)
+	{
+		delete chunk;
+	}
+	this->completedChunks.clear();
+
+	for (const std::pair<const int, MapChunk*>& chunk : this->residentChunks)
+	{
+		delete chunk.second;
+	}
+	this->residentChunks.clear();
+}
+
+bool MapChunkStreamer::Initialize(ThreadPool* threadPool)
+{
+#if _DEBUG
+	assert(threadPool);
+#endif
+
+	const int numberOfLayers = this->tileDataFilePathsByLayer.size();
+	this->rowOffsetsByLayer.resize(numberOfLayers);
+
+	//each layer file is indexed on its own thread, they're independent
+	std::vector<int> columnCountsByLayer(numberOfLayers, 0);
+	std::vector<unsigned char> indexSuccessByLayer(numberOfLayers, 0);
+	for (int layer = 0; layer < numberOfLayers; layer++)
+	{
+		threadPool->Enqueue([this, &columnCountsByLayer, &indexSuccessByLayer, layer]()
+		{
+			indexSuccessByLayer[layer] = this->indexDataFile(this->tileDataFilePathsByLayer.at(layer), this->rowOffsetsByLayer.at(layer), columnCountsByLayer[layer]) ? 1 : 0;
+		});
+	}
+	threadPool->Wait();
+
+	for (int layer = 0; layer < numberOfLayers; layer++)
+	{
+		if (!indexSuccessByLayer[layer])
+		{
+			printf("Unable to read map layer %s\n", this->tileDataFilePathsByLayer.at(layer).c_str());
+			return false;
+		}
+
+		const int fileRowCount = this->rowOffsetsByLayer.at(layer).size();
+		const int fileColumnCount = columnCountsByLayer[layer];
+
+		if (layer == 0)
+		{
+			this->rowCount = fileRowCount;
+			this->columnCount = fileColumnCount;
+		}
+		else if (this->rowCount != fileRowCount || this->columnCount != fileColumnCount)
+		{
+			//every layer has to cover the same grid
+			printf("Map layer %s is %dx%d but %s is %dx%d\n", this->tileDataFilePathsByLayer.at(layer).c_str(), fileRowCount, fileColumnCount, this->tileDataFilePathsByLayer.at(0).c_str(), this->rowCount, this->columnCount);
+			return false;
+		}
+	}
+
+	this->chunkRowCount = (this->rowCount + MAP_CHUNK_SIZE - 1) / MAP_CHUNK_SIZE;
+	this->chunkColumnCount = (this->columnCount + MAP_CHUNK_SIZE - 1) / MAP_CHUNK_SIZE;
+
+	this->worker = std::thread(&MapChunkStreamer::workerLoop, this);
+
+	return true;
+}
+
+void MapChunkStreamer::Update(int firstChunkRow, int firstChunkColumn, int lastChunkRow, int lastChunkColumn)
+{
+	this->currentFrame++;
+
+	this->collectCompletedChunks();
+
+	firstChunkRow = std::max(0, firstChunkRow);
+	firstChunkColumn = std::max(0, firstChunkColumn);
+	lastChunkRow = std::min(this->chunkRowCount - 1, lastChunkRow);
+	lastChunkColumn = std::min(this->chunkColumnCount - 1, lastChunkColumn);
+
+	//request anything in the wanted area that isn't resident or already on its way
+	std::vector<int> newRequests;
+	for (int chunkRow = firstChunkRow; chunkRow <= lastChunkRow; chunkRow++)
+	{
+		for (int chunkColumn = firstChunkColumn; chunkColumn <= lastChunkColumn; chunkColumn++)
+		{
+			const int key = this->getChunkKey(chunkRow, chunkColumn);
+
+			std::unordered_map<int, MapChunk*>::iterator it = this->residentChunks.find(key);
+			if (it != this->residentChunks.end())
+			{
+				it->second->lastUsedFrame = this->currentFrame;
+				continue;
+			}
+
+			if (this->pendingChunks.find(key) != this->pendingChunks.end() || this->failedChunks.find(key) != this->failedChunks.end())
+				continue;
+
+			this->pendingChunks.insert({ key, std::chrono::steady_clock::now() });
+			newRequests.push_back(key);
+		}
+	}
+
+	if (!newRequests.empty())
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->queueMutex);
+			this->requestQueue.insert(this->requestQueue.end(), newRequests.begin(), newRequests.end());
+		}
+		this->queueCondition.notify_one();
+	}
+
+	this->evictChunks(firstChunkRow, firstChunkColumn, lastChunkRow, lastChunkColumn);
+
+	this->stats.residentChunks = this->residentChunks.size();
+}
+
+const MapChunk* MapChunkStreamer::GetChunk(int chunkRow, int chunkColumn) const
+{
+	std::unordered_map<int, MapChunk*>::const_iterator it = this->residentChunks.find(this->getChunkKey(chunkRow, chunkColumn));
+	if (it == this->residentChunks.end())
+	{
+		this->missCount.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	this->hitCount.fetch_add(1, std::memory_order_relaxed);
+	return it->second;
+}
+
+MapChunk* MapChunkStreamer::GetChunkForEdit(int chunkRow, int chunkColumn)
+{
+	std::unordered_map<int, MapChunk*>::iterator it = this->residentChunks.find(this->getChunkKey(chunkRow, chunkColumn));
+	if (it == this->residentChunks.end())
+	{
+		this->missCount.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	this->hitCount.fetch_add(1, std::memory_order_relaxed);
+
+	//edits only live in memory, so keep this chunk around for the life of the map
+	it->second->pinned = true;
+	return it->second;
+}
+
+int MapChunkStreamer::GetRowCount() const
+{
+	return this->rowCount;
+}
+
+int MapChunkStreamer::GetColumnCount() const
+{
+	return this->columnCount;
+}
+
+int MapChunkStreamer::GetChunkRowCount() const
+{
+	return this->chunkRowCount;
+}
+
+int MapChunkStreamer::GetChunkColumnCount() const
+{
+	return this->chunkColumnCount;
+}
+
+int MapChunkStreamer::GetResidentChunkBudget() const
+{
+	return this->residentChunkBudget;
+}
+
+void MapChunkStreamer::SetResidentChunkBudget(int budget)
+{
+	this->residentChunkBudget = budget;
+}
+
+const MapChunkStreamingStats& MapChunkStreamer::GetStats() const
+{
+	this->stats.hits = this->hitCount.load(std::memory_order_relaxed);
+	this->stats.misses = this->missCount.load(std::memory_order_relaxed);
+	return this->stats;
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+bool MapChunkStreamer::indexDataFile(const std::string& tileDataFilepath, std::vector<std::streamoff>& rowOffsets, int& fileColumnCount)
+{
+	std::ifstream file(tileDataFilepath.c_str(), std::ios::binary);
+
+	if (!file.is_open())
+		return false;
+
+	rowOffsets.clear();
+	fileColumnCount = 0;
+
+	std::streamoff offset = 0;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		const std::streamoff lineOffset = offset;
+		offset += line.length() + 1;	//+1 for the newline getline consumed
+
+		//blank lines don't count as rows, same as CsvMapLoader
+		if (std::all_of(line.begin(), line.end(), [](char c) { return isspace(static_cast<unsigned char>(c)); }))
+			continue;
+
+		//the first row decides the width, loadChunk() fails any chunk with a row that doesn't match it
+		if (rowOffsets.empty())
+		{
+			int unusedBadTileId = -1;
+			fileColumnCount = CsvMapLoader::ParseRow(line.data(), line.data() + line.length(), nullptr, nullptr, 0, 0, unusedBadTileId);
+		}
+
+		rowOffsets.push_back(lineOffset);
+	}
+
+	file.close();
+
+	return !rowOffsets.empty();
+}
+
+void MapChunkStreamer::workerLoop()
+{
+	//each layer file stays open for the life of the worker so chunk loads are just seeks
+	std::vector<std::ifstream> files;
+	for (const std::string& filepath : this->tileDataFilePathsByLayer)
+	{
+		files.emplace_back(filepath.c_str(), std::ios::binary);
+	}
+
+	while (true)
+	{
+		int key = -1;
+
+		{
+			std::unique_lock<std::mutex> lock(this->queueMutex);
+			this->queueCondition.wait(lock, [this]() { return this->stopRequested || !this->requestQueue.empty(); });
+
+			if (this->stopRequested)
+				return;
+
+			key = this->requestQueue.front();
+			this->requestQueue.pop_front();
+		}
+
+		MapChunk* chunk = this->loadChunk(files, key);
+
+		{
+			std::lock_guard<std::mutex> lock(this->queueMutex);
+			if (chunk)
+				this->completedChunks.push_back(chunk);
+			else
+				this->failedChunkKeys.push_back(key);
+		}
+	}
+}
+
+MapChunk* MapChunkStreamer::loadChunk(std::vector<std::ifstream>& files, int key) const
+{
+	MapChunk* chunk = new MapChunk();
+	chunk->chunkRow = key / this->chunkColumnCount;
+	chunk->chunkColumn = key % this->chunkColumnCount;
+	chunk->lastUsedFrame = 0;
+	chunk->pinned = false;
+
+	const int firstRow = chunk->chunkRow * MAP_CHUNK_SIZE;
+	const int firstColumn = chunk->chunkColumn * MAP_CHUNK_SIZE;
+	chunk->rowCount = std::min(MAP_CHUNK_SIZE, this->rowCount - firstRow);
+	chunk->columnCount = std::min(MAP_CHUNK_SIZE, this->columnCount - firstColumn);
+
+	const int cellCount = chunk->rowCount * chunk->columnCount;
+	const int numberOfLayers = files.size();
+	chunk->tilesByLayer.resize(numberOfLayers);
+
+	std::string line;
+	for (int layer = 0; layer < numberOfLayers; layer++)
+	{
+		std::ifstream& file = files.at(layer);
+		std::vector<MapTile>& mapTiles = chunk->tilesByLayer.at(layer);
+		mapTiles.resize(cellCount);
+
+		for (int row = 0; row < chunk->rowCount; row++)
+		{
+			file.clear();
+			file.seekg(this->rowOffsetsByLayer.at(layer).at(firstRow + row));
+			std::getline(file, line);
+
+			//the whole row is counted so a short or long one is caught, only this chunk's columns are kept
+			int badTileId = -1;
+			const int rowColumnCount = CsvMapLoader::ParseRow(line.data(), line.data() + line.length(), this->tileset, mapTiles.data() + (row * chunk->columnCount), firstColumn, chunk->columnCount, badTileId);
+
+			if (rowColumnCount != this->columnCount || badTileId != -1)
+			{
+				if (badTileId != -1)
+					printf("Map layer %s row %d uses tile id %d but the tileset only has %d tiles\n", this->tileDataFilePathsByLayer.at(layer).c_str(), firstRow + row, badTileId, this->tileset->tileCount);
+				else
+					printf("Map layer %s row %d has %d columns but the map is %d wide\n", this->tileDataFilePathsByLayer.at(layer).c_str(), firstRow + row, rowColumnCount, this->columnCount);
+
+				delete chunk;
+				return nullptr;
+			}
+		}
+	}
+
+	//merge walkability across the layers, same rule as Map's full bitmap
+	chunk->walkableBits.assign((cellCount + WALKABLE_BITS_PER_WORD - 1) / WALKABLE_BITS_PER_WORD, 0u);
+	for (int index = 0; index < cellCount; index++)
+	{
+		bool walkable = true;
+		for (const std::vector<MapTile>& mapTiles : chunk->tilesByLayer)
+		{
+			if (!mapTiles[index].GetIsWalkable())
+			{
+				walkable = false;
+				break;
+			}
+		}
+
+		if (walkable)
+			chunk->walkableBits[index / WALKABLE_BITS_PER_WORD] |= 1u << (index % WALKABLE_BITS_PER_WORD);
+	}
+
+	return chunk;
+}
+
+void MapChunkStreamer::collectCompletedChunks()
+{
+	std::vector<MapChunk*> chunks;
+	std::vector<int> failedKeys;
+
+	{
+		std::lock_guard<std::mutex> lock(this->queueMutex);
+		chunks.swap(this->completedChunks);
+		failedKeys.swap(this->failedChunkKeys);
+	}
+
+	//the file won't get any better by reading it again, so these stay missing (treated like off the edge of the map)
+	for (int key : failedKeys)
+	{
+		this->pendingChunks.erase(key);
+		this->failedChunks.insert(key);
+		this->stats.chunksFailed++;
+	}
+
+	const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+	for (MapChunk* chunk : chunks)
+	{
+		const int key = this->getChunkKey(chunk->chunkRow, chunk->chunkColumn);
+
+		std::unordered_map<int, std::chrono::steady_clock::time_point>::iterator pending = this->pendingChunks.find(key);
+		if (pending != this->pendingChunks.end())
+		{
+			const unsigned long long latency = std::chrono::duration_cast<std::chrono::microseconds>(now - pending->second).count();
+			this->stats.totalLoadLatencyInMicroseconds += latency;
+			this->stats.maxLoadLatencyInMicroseconds = std::max(this->stats.maxLoadLatencyInMicroseconds, latency);
+			this->pendingChunks.erase(pending);
+		}
+
+		chunk->lastUsedFrame = this->currentFrame;
+		this->residentChunks.insert({ key, chunk });
+		this->stats.chunksLoaded++;
+	}
+}
+
+void MapChunkStreamer::evictChunks(int firstChunkRow, int firstChunkColumn, int lastChunkRow, int lastChunkColumn)
+{
+	if (static_cast<int>(this->residentChunks.size()) <= this->residentChunkBudget)
+		return;
+
+	//anything outside the wanted area that isn't pinned can go, least recently used first
+	std::vector<MapChunk*> candidates;
+	for (const std::pair<const int, MapChunk*>& resident : this->residentChunks)
+	{
+		const MapChunk* chunk = resident.second;
+
+		const bool isWanted = chunk->chunkRow >= firstChunkRow && chunk->chunkRow <= lastChunkRow && chunk->chunkColumn >= firstChunkColumn && chunk->chunkColumn <= lastChunkColumn;
+		if (isWanted || chunk->pinned)
+			continue;
+
+		candidates.push_back(resident.second);
+	}
+
+	std::sort(candidates.begin(), candidates.end(), [](const MapChunk* a, const MapChunk* b) { return a->lastUsedFrame < b->lastUsedFrame; });
+
+	for (MapChunk* chunk : candidates)
+	{
+		if (static_cast<int>(this->residentChunks.size()) <= this->residentChunkBudget)
+			break;
+
+		this->residentChunks.erase(this->getChunkKey(chunk->chunkRow, chunk->chunkColumn));
+		delete chunk;
+		this->stats.chunksEvicted++;
+	}
+}
+
+int MapChunkStreamer::getChunkKey(int chunkRow, int chunkColumn) const
+{
+	return (chunkRow * this->chunkColumnCount) + chunkColumn;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "MapTile.h"
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+
+#pragma region Forward Declarations
+class ThreadPool;
+#pragma endregion
+
+//a MAP_CHUNK_SIZE x MAP_CHUNK_SIZE block of every layer of a streamed map (edge chunks may be smaller)
+struct MapChunk
+{
+	int chunkRow;
+	int chunkColumn;
+	int rowCount;
+	int columnCount;
+	std::vector<std::vector<MapTile>> tilesByLayer;		//row-major within the chunk, same layout as Map's full grids
+	std::vector<unsigned int> walkableBits;				//merged over all layers, one bit per cell
+	unsigned int lastUsedFrame;
+	bool pinned;										//modified at runtime, so it can't be evicted and reloaded from disk
+};
+
+struct MapChunkStreamingStats
+{
+	unsigned int hits;
+	unsigned int misses;
+	unsigned int chunksLoaded;
+	unsigned int chunksEvicted;
+	unsigned int chunksFailed;							//had a malformed row, they're never requested again
+	unsigned int residentChunks;
+	unsigned long long totalLoadLatencyInMicroseconds;	//from request until the chunk is resident
+	unsigned long long maxLoadLatencyInMicroseconds;
+};
+
+class MapChunkStreamer
+{
+public:
+	MapChunkStreamer(const std::vector<std::string>& tileDataFilePathsByLayer, TilesetHandle tilesetHandle, int residentChunkBudget);
+	~MapChunkStreamer();
+
+	bool Initialize(ThreadPool* threadPool);
+
+	void Update(int firstChunkRow, int firstChunkColumn, int lastChunkRow, int lastChunkColumn);
+
+	const MapChunk* GetChunk(int chunkRow, int chunkColumn) const;
+	MapChunk* GetChunkForEdit(int chunkRow, int chunkColumn);
+
+	int GetRowCount() const;
+	int GetColumnCount() const;
+	int GetChunkRowCount() const;
+	int GetChunkColumnCount() const;
+
+	int GetResidentChunkBudget() const;
+	void SetResidentChunkBudget(int budget);
+
+	const MapChunkStreamingStats& GetStats() const;
+
+private:
+	bool indexDataFile(const std::string& tileDataFilepath, std::vector<std::streamoff>& rowOffsets, int& fileColumnCount);
+	void workerLoop();
+	MapChunk* loadChunk(std::vector<std::ifstream>& files, int key) const;
+	void collectCompletedChunks();
+	void evictChunks(int firstChunkRow, int firstChunkColumn, int lastChunkRow, int lastChunkColumn);
+	int getChunkKey(int chunkRow, int chunkColumn) const;
+
+	const std::vector<std::string> tileDataFilePathsByLayer;
+	const Tileset* tileset;		//resolved up front, the worker thread never touches the registry
+	int residentChunkBudget;
+	int rowCount = 0;
+	int columnCount = 0;
+	int chunkRowCount = 0;
+	int chunkColumnCount = 0;
+	unsigned int currentFrame = 0;
+
+	std::vector<std::vector<std::streamoff>> rowOffsetsByLayer;	//byte offset of every row in each layer's file, so chunks can seek straight to their rows
+
+	//only touched by the main thread
+	std::unordered_map<int, MapChunk*> residentChunks;
+	std::unordered_map<int, std::chrono::steady_clock::time_point> pendingChunks;
+	std::unordered_set<int> failedChunks;
+	mutable MapChunkStreamingStats stats = {};
+	mutable std::atomic<unsigned int> hitCount{ 0 };		//lookups can come from job system workers while entities update, GetStats() copies these into stats
+	mutable std::atomic<unsigned int> missCount{ 0 };
+
+	//shared with the worker thread, guarded by queueMutex
+	std::mutex queueMutex;
+	std::condition_variable queueCondition;
+	std::deque<int> requestQueue;
+	std::vector<MapChunk*> completedChunks;
+	std::vector<int> failedChunkKeys;
+	bool stopRequested = false;
+
+	std::thread worker;
+};
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "MapRegistry.h"
+#include "TmxLoader.h"
+#include "MapBundle.h"
+#include <fstream>
+#include <stdio.h>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+static void trim(std::string& s)
+{
+	while (s.size() && isspace(s.front()))	//front
+		s.erase(s.begin());
+	while (s.size() && isspace(s.back()))	//back
+		s.pop_back();
+}
+
+static std::vector<std::string> split(const std::string& s, char delimiter)
+{
+	std::vector<std::string> parts;
+
+	size_t startPosition = 0;
+	size_t endPosition = s.find(delimiter, startPosition);
+	while (endPosition != std::string::npos)
+	{
+		parts.push_back(s.substr(startPosition, endPosition - startPosition));
+
+		startPosition = endPosition + 1; //+1 to skip delimiter
+		endPosition = s.find(delimiter, startPosition);
+	}
+
+	//no delimiter after last one, but don't forget to include it
+	parts.push_back(s.substr(startPosition));
+
+	for (std::string& part : parts)
+	{
+		trim(part);
+	}
+
+	return parts;
+}
+
+#pragma region Public Methods
+
+bool MapRegistry::Initialize(const std::string& manifestFilepath)
+{
+#if _DEBUG
+	assert(MapRegistry::maps.empty());	//already initialized!
+#endif
+
+	std::ifstream file(manifestFilepath.c_str());
+
+	if (!file.is_open())
+	{
+		printf("Failed to open map manifest: %s\n", manifestFilepath.c_str());
+		return false;
+	}
+
+	std::string line;
+	while (std::getline(file, line))
+	{
+		trim(line);
+
+		if (line.empty())
+			continue;
+
+		//skip comment lines
+		if (line.length() >= 2 && line[0] == '-' && line[1] == '-')
+			continue;
+
+		if (!MapRegistry::parseLine(line, manifestFilepath))
+		{
+			MapRegistry::ShutDown();
+			return false;
+		}
+	}
+
+	file.close();
+
+	if (MapRegistry::maps.empty())
+	{
+		printf("Map manifest %s doesn't list any maps\n", manifestFilepath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+void MapRegistry::ShutDown()
+{
+	MapRegistry::maps.clear();
+	MapRegistry::handlesByName.clear();
+}
+
+MapHandle MapRegistry::GetHandle(const std::string& name)
+{
+	const std::map<std::string, MapHandle>::const_iterator it = MapRegistry::handlesByName.find(name);
+	if (it == MapRegistry::handlesByName.end())
+		return INVALID_MAP_HANDLE;
+
+	return it->second;
+}
+
+const MapDefinition& MapRegistry::Get(MapHandle handle)
+{
+#if _DEBUG
+	assert(handle >= 0 && handle < static_cast<int>(MapRegistry::maps.size()));
+#endif
+
+	return MapRegistry::maps[handle];
+}
+
+int MapRegistry::GetCount()
+{
+	return MapRegistry::maps.size();
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+bool MapRegistry::parseLine(const std::string& line, const std::string& manifestFilepath)
+{
+	//Name; MapFilePaths; TilesetFilePath; TeleportersFilePath; SpawnsFilePath
+	std::vector<std::string> fields = split(line, ';');
+
+	//tolerate a trailing ';'
+	if (fields.size() > 1 && fields.back().empty())
+		fields.pop_back();
+
+	MapDefinition definition;
+	definition.name = fields.at(0);
+
+	if (definition.name.empty() || fields.size() < 2)
+	{
+		printf("Malformed map manifest line in %s: %s\n", manifestFilepath.c_str(), line.c_str());
+		return false;
+	}
+
+	if (MapRegistry::handlesByName.count(definition.name))
+	{
+		printf("Map %s is listed more than once in %s\n", definition.name.c_str(), manifestFilepath.c_str());
+		return false;
+	}
+
+	definition.mapFilePathsByLayer = split(fields.at(1), ',');
+	definition.isTmx = definition.mapFilePathsByLayer.size() == 1 && TmxLoader::IsTmxFile(definition.mapFilePathsByLayer.at(0));
+
+	if (!definition.isTmx)
+	{
+		if (fields.size() != 5)
+		{
+			printf("Map %s in %s needs a tileset, teleporters and spawns file\n", definition.name.c_str(), manifestFilepath.c_str());
+			return false;
+		}
+
+		definition.tilesetFilePath = fields.at(2);
+		definition.teleportersFilePath = fields.at(3);
+		definition.spawnsFilePath = fields.at(4);
+
+		//resolve the tileset now so loading the map never has to look it up by path
+		definition.tilesetHandle = TilesetRegistry::Load(definition.tilesetFilePath);
+		if (definition.tilesetHandle == INVALID_TILESET_HANDLE)
+			return false;
+
+		//the bundle sits next to the layer files it was built from
+		const std::string& firstLayerFilePath = definition.mapFilePathsByLayer.at(0);
+		const size_t directoryEnd = firstLayerFilePath.find_last_of("/\\");
+		const std::string directory = (directoryEnd == std::string::npos) ? "" : firstLayerFilePath.substr(0, directoryEnd + 1);
+		definition.bundleFilePath = directory + definition.name + MAP_BUNDLE_FILE_EXTENSION;
+	}
+
+	MapRegistry::handlesByName[definition.name] = MapRegistry::maps.size();
+	MapRegistry::maps.push_back(definition);
+
+	return true;
+}
+
+#pragma endregion
+
+#pragma region Static Member Initialization
+
+std::vector<MapDefinition> MapRegistry::maps;
+std::map<std::string, MapHandle> MapRegistry::handlesByName;
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "TilesetRegistry.h"
+#include <string>
+#include <vector>
+#include <map>
+
+typedef int MapHandle;
+
+#define INVALID_MAP_HANDLE	-1
+
+//one manifest entry, everything needed to load a map without any further lookups
+struct MapDefinition
+{
+	std::string name;
+	std::vector<std::string> mapFilePathsByLayer;	//a single .tmx, or one .csv per layer
+	bool isTmx = false;
+
+	//only used by .csv maps, a .tmx carries its own tileset, teleporters and spawns
+	std::string tilesetFilePath;
+	TilesetHandle tilesetHandle = INVALID_TILESET_HANDLE;
+	std::string teleportersFilePath;
+	std::string spawnsFilePath;
+	std::string bundleFilePath;						//compiled bundle (see MapBundle::Compile), preferred over the .csv files when it exists
+};
+
+//reads the map manifest once at startup and interns every map into a handle, everything else refers to maps by handle
+class MapRegistry
+{
+public:
+	MapRegistry() = delete;
+
+	static bool Initialize(const std::string& manifestFilepath);
+	static void ShutDown();
+
+	static MapHandle GetHandle(const std::string& name);
+	static const MapDefinition& Get(MapHandle handle);
+	static int GetCount();
+
+private:
+	static bool parseLine(const std::string& line, const std::string& manifestFilepath);
+
+	static std::vector<MapDefinition> maps;						//indexed by handle
+	static std::map<std::string, MapHandle> handlesByName;		//only used while reading data files, never per frame
+};
\ No newline at end of file
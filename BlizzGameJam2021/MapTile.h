@@ -1,34 +1,28 @@
 #pragma once
 
-#include <string>
+#include "TilesetRegistry.h"
 
 #pragma region Forward Declarations
 class Texture;
 #pragma endregion
 
+//compact per-cell tile record, stored by value in Map's per-layer grids
 class MapTile
 {
 public:
-	MapTile(const std::string& mapFileNameName, const int id, const int worldGridRow, const int worldGridColumn);
+	MapTile();
+	MapTile(const Tileset& tileset, const int id);
 	~MapTile();
 
-	void Draw(Texture* texture, int cameraShiftX, int cameraShiftY) const;
+	void DrawImmediate(const Texture* texture, const Tileset& tileset, int x, int y) const;
 
-	int GetWorldGridRow() const;
-	int GetWorldGridColumn() const;
+	int GetId() const;
 
 	bool GetIsWalkable() const;
 	bool GetIsObject() const;
 
-	static int GetMapIdByFileName(const std::string& filename);
-
-	static bool InitInteriorTileInfo();
-
 private:
-	int mapUniqueId;
-	const int id;
-	const int worldGridRow;
-	const int worldGridColumn;
+	unsigned short id;
 	bool walkable;
 	bool isObject;
 };
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "Object.h"
 #include "Texture.h"
+#include "TextureCache.h"
 #include "Display.h"
+#include "Constants.h"
+#include "CollisionKernel.h"
 
 #ifdef _DEBUG
 	#include <assert.h>
@@ -18,11 +21,10 @@ Object::Object(double spawnX, double spawnY, int width, int height, const std::s
 
 	this->x = spawnX;
 	this->y = spawnY;
+	this->previousX = spawnX;
+	this->previousY = spawnY;
 
 	this->SetTexture(texturePath);
-
-	// fix the rendering space
-	this->texture->SetRenderOffset(this->width / 2, this->height / 2);
 }
 
 #pragma endregion
@@ -31,10 +33,8 @@ Object::Object(double spawnX, double spawnY, int width, int height, const std::s
 
 Object::~Object()
 {
-	if (this->texture)
-	{
-		delete this->texture;
-	}
+	TextureCache::Release(this->texture);
+	this->texture = nullptr;
 }
 
 void Object::Draw()
@@ -44,7 +44,8 @@ void Object::Draw()
 	assert(this->height);
 #endif
 
-	Display::QueueTextureForRendering(this->texture, this->x, this->y, this->width, this->height, true, this->layer);
+	//the texture is shared with anything else using the same image, so shift to the top left corner here instead of through its render offset
+	Display::QueueTextureForRendering(this->texture, static_cast<int>(this->x) - (this->width / 2), static_cast<int>(this->y) - (this->height / 2), this->width, this->height, false, this->layer);
 }
 
 bool Object::TestCollision(const Object* otherObject) const
@@ -54,52 +55,12 @@ bool Object::TestCollision(const Object* otherObject) const
 	assert(this->height);
 #endif
 
-	const int thisHalfWidth = this->width / 2;
-	const int thisHalfHeight = this->height / 2;
-	const int otherHalfWidth = otherObject->width / 2;
-	const int otherHalfHeight = otherObject->height / 2;
-
-	//The sides of the rectangles
-	int leftA, leftB;
-	int rightA, rightB;
-	int topA, topB;
-	int bottomA, bottomB;
-
-	//Calculate the sides of rect A
-	leftA = this->x - thisHalfWidth;
-	rightA = this->x + thisHalfWidth;
-	topA = this->y - thisHalfHeight;
-	bottomA = this->y + thisHalfHeight;
-
-	//Calculate the sides of rect B
-	leftB = otherObject->x - otherHalfWidth;
-	rightB = otherObject->x + otherHalfWidth;
-	topB = otherObject->y - otherHalfHeight;
-	bottomB = otherObject->y + otherHalfHeight;
-
-	//If any of the sides from A are outside of B
-	if (bottomA <= topB)
-	{
-		return false;
-	}
-
-	if (topA >= bottomB)
-	{
-		return false;
-	}
-
-	if (rightA <= leftB)
-	{
-		return false;
-	}
+	int leftA, topA, rightA, bottomA;
+	int leftB, topB, rightB, bottomB;
+	CollisionKernel::GetEdges(this->x, this->y, this->width, this->height, leftA, topA, rightA, bottomA);
+	CollisionKernel::GetEdges(otherObject->x, otherObject->y, otherObject->width, otherObject->height, leftB, topB, rightB, bottomB);
 
-	if (leftA >= rightB)
-	{
-		return false;
-	}
-
-	//If none of the sides from A are outside B
-	return true;
+	return CollisionKernel::TestEdges(leftA, topA, rightA, bottomA, leftB, topB, rightB, bottomB);
 }
 
 bool Object::TestCollisionWithRect(const SDL_Rect* thing) const
@@ -109,67 +70,25 @@ bool Object::TestCollisionWithRect(const SDL_Rect* thing) const
 	assert(this->height);
 #endif
 
-	const int thisHalfWidth = this->width / 2;
-	const int thisHalfHeight = this->height / 2;
-	const int otherHalfWidth = thing->w / 2;
-	const int otherHalfHeight = thing->h / 2;
-
-	//The sides of the rectangles
-	int leftA, leftB;
-	int rightA, rightB;
-	int topA, topB;
-	int bottomA, bottomB;
-
-	//Calculate the sides of rect A
-	leftA = this->x - thisHalfWidth;
-	rightA = this->x + thisHalfWidth;
-	topA = this->y - thisHalfHeight;
-	bottomA = this->y + thisHalfHeight;
-
-	//Calculate the sides of rect B
-	leftB = thing->x - otherHalfWidth;
-	rightB = thing->x + otherHalfWidth;
-	topB = thing->y - otherHalfHeight;
-	bottomB = thing->y + otherHalfHeight;
-
-	//If any of the sides from A are outside of B
-	if (bottomA <= topB)
-	{
-		return false;
-	}
+	int leftA, topA, rightA, bottomA;
+	int leftB, topB, rightB, bottomB;
+	CollisionKernel::GetEdges(this->x, this->y, this->width, this->height, leftA, topA, rightA, bottomA);
+	CollisionKernel::GetEdges(thing->x, thing->y, thing->w, thing->h, leftB, topB, rightB, bottomB);
 
-	if (topA >= bottomB)
-	{
-		return false;
-	}
-
-	if (rightA <= leftB)
-	{
-		return false;
-	}
-
-	if (leftA >= rightB)
-	{
-		return false;
-	}
-
-	//If none of the sides from A are outside B
-	return true;
+	return CollisionKernel::TestEdges(leftA, topA, rightA, bottomA, leftB, topB, rightB, bottomB);
 }
 
 void Object::SetTexture(const std::string& texturePath)
 {
-	if (this->texture)
-	{
-		delete this->texture;
-	}
-
-	this->texture = new Texture(texturePath);
-	bool loadTextureResult = this->texture->Load();
+	//acquire first, so switching to the texture we already have doesn't free and reload it
+	Texture* texture = TextureCache::Acquire(texturePath);
 
 #if _DEBUG
-	assert(loadTextureResult);
+	assert(texture);
 #endif
+
+	TextureCache::Release(this->texture);
+	this->texture = texture;
 }
 
 double Object::GetPositionX() const
@@ -182,6 +101,16 @@ double Object::GetPositionY() const
 	return this->y;
 }
 
+double Object::GetInterpolatedPositionX(double interpolation) const
+{
+	return this->previousX + ((this->x - this->previousX) * interpolation);
+}
+
+double Object::GetInterpolatedPositionY(double interpolation) const
+{
+	return this->previousY + ((this->y - this->previousY) * interpolation);
+}
+
 int Object::GetWidth() const
 {
 	return this->width;
@@ -194,8 +123,11 @@ int Object::GetHeight() const
 
 void Object::SetPosition(double x, double y)
 {
+	//a jump rather than a move, so don't draw anything in between
 	this->x = x;
 	this->y = y;
+	this->previousX = x;
+	this->previousY = y;
 }
 
 Direction Object::GetFacing() const
@@ -204,3 +136,28 @@ Direction Object::GetFacing() const
 }
 
 #pragma endregion
+
+#pragma region Protected Methods
+
+bool Object::isInCameraView(const SDL_Rect& camera) const
+{
+	const int halfWidth = this->width / 2;
+	const int halfHeight = this->height / 2;
+
+	//objects are positioned by their center point, the camera by its top left corner
+	if (this->x + halfWidth < camera.x - DRAW_CULLING_MARGIN)
+		return false;
+
+	if (this->x - halfWidth > camera.x + CAMERA_VIEW_WIDTH + DRAW_CULLING_MARGIN)
+		return false;
+
+	if (this->y + halfHeight < camera.y - DRAW_CULLING_MARGIN)
+		return false;
+
+	if (this->y - halfHeight > camera.y + CAMERA_VIEW_HEIGHT + DRAW_CULLING_MARGIN)
+		return false;
+
+	return true;
+}
+
+#pragma endregion
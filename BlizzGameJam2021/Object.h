@@ -5,7 +5,7 @@
 #pragma region Forward Declarations
 class Texture;
 struct SDL_Rect;
-enum RenderLayers;
+enum RenderLayers : int;
 #pragma endregion
 
 enum Direction
@@ -33,6 +33,8 @@ public:
 
 	double GetPositionX() const;
 	double GetPositionY() const;
+	double GetInterpolatedPositionX(double interpolation) const;
+	double GetInterpolatedPositionY(double interpolation) const;
 
 	int GetWidth() const;
 	int GetHeight() const;
@@ -42,8 +44,12 @@ public:
 	Direction GetFacing() const;
 
 protected:
+	bool isInCameraView(const SDL_Rect& camera) const;
+
 	double x;
 	double y;
+	double previousX;		//where the previous simulation tick left us, drawing blends from here to x/y
+	double previousY;
 	const int width;
 	const int height;
 	Direction facing;
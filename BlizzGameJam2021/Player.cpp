@@ -1,7 +1,7 @@
 #include "Player.h"
 #include "Game.h"
 #include "Map.h"
-#include "MapTile.h"
+#include "TileCollider.h"
 #include "Display.h"
 #include "Constants.h"
 
@@ -51,63 +51,12 @@ void Player::InjectFrame(unsigned int elapsedGameTime, unsigned int previousFram
 {
 	double previousFrameTimeInSeconds = (previousFrameTime / 1000.0);
 
-	double startPosX = this->x;
-	double startPosY = this->y;
-	int startTileRow = static_cast<int>((this->y + (this->height / 2)) / TILE_HEIGHT);
-	int startTileColumn = static_cast<int>((this->x + (this->width / 2)) / TILE_WIDTH);
+	this->previousX = this->x;
+	this->previousY = this->y;
 
-	//update position
-	this->x += (this->horizontalVelocity * previousFrameTimeInSeconds);
-	this->y += (this->verticalVelocity * previousFrameTimeInSeconds);
-
-	//enforce screen bounds
-	int halfWidth = this->width / 2;
-	int halfHeight = this->height / 2;
-
-	const Game* game = Game::GetInstance();
-	const Map* map = game->GetMap();
-	const int mapWidth = map->GetColumnCount() * TILE_WIDTH;
-	const int mapHeight = map->GetRowCount() * TILE_HEIGHT;
-
-	if (this->x - halfWidth < 0)
-	{
-		this->x = halfWidth;
-	}
-	else if (this->x + halfWidth > mapWidth)
-	{
-		this->x = mapWidth - halfWidth;
-	}
-
-	if (this->y - halfHeight < 0)
-	{
-		this->y = halfHeight;
-	}
-	else if (this->y + halfHeight > mapHeight)
-	{
-		this->y = mapHeight - halfHeight;
-	}
-
-	//check if we're attempting to cross to a new tile that isn't walkable
-	int endTileRow = static_cast<int>((this->y + (this->height / 2)) / TILE_HEIGHT);
-	int endTileColumn = static_cast<int>((this->x + (this->width / 2)) / TILE_WIDTH);
-
-	if (startTileRow != endTileRow || startTileColumn != endTileColumn)
-	{
-		//we crossed into a new tile, check if it's walkable
-		const int numberOfMapLayers = map->GetNumberOfLayers();
-		for (int layer = 0; layer < numberOfMapLayers; layer++)
-		{
-			//each layer of the map has different walkable data so have to check each layer
-			const MapTile* tile = map->GetTileByWorldGridLocation(endTileRow, endTileColumn, layer);
-			if (tile == nullptr || !tile->GetIsWalkable())
-			{
-				//not walkable, so move them back!
-				this->x = startPosX;
-				this->y = startPosY;
-				break;
-			}
-		}
-	}
+	//update position, stopping at (and sliding along) tiles that aren't walkable and the edges of the map
+	const Map* map = Game::GetInstance()->GetMap();
+	TileCollider::Move(map, this->x, this->y, this->width, this->height, this->horizontalVelocity * previousFrameTimeInSeconds, this->verticalVelocity * previousFrameTimeInSeconds);
 
 	//animation
 	if (this->animationSwapCooldown <= 0)
@@ -128,7 +77,13 @@ void Player::Draw()
 	const Game* game = Game::GetInstance();
 	const SDL_Rect& camera = game->GetCamera();
 
-	Display::QueueTextureForRendering(this->texture, this->x - camera.x, this->y - camera.y, this->width, this->height, true, RenderLayers::PLAYER, true, this->spriteSheetOffsetX, this->spriteSheetOffsetY);
+	if (this->isInCameraView(camera))
+	{
+		//somewhere between the last two ticks, depending on when this frame is drawn
+		const int screenX = static_cast<int>(this->GetInterpolatedPositionX(game->GetInterpolation()) - camera.x) - (this->width / 2);
+		const int screenY = static_cast<int>(this->GetInterpolatedPositionY(game->GetInterpolation()) - camera.y) - (this->height / 2);
+		Display::QueueTextureForRendering(this->texture, screenX, screenY, this->width, this->height, false, RenderLayers::PLAYER, true, this->spriteSheetOffsetX, this->spriteSheetOffsetY);
+	}
 
 	//debug position text
 #if _DEBUG
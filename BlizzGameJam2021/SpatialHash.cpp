@@ -0,0 +1,300 @@
+#include "SpatialHash.h"
+#include <algorithm>
+#include <cmath>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Constructor
+
+SpatialHash::SpatialHash(int cellSize)
+	: cellSize(cellSize)
+{
+#if _DEBUG
+	assert(cellSize > 0);
+#endif
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+void SpatialHash::Clear()
+{
+	this->entries.clear();
+	this->bounds.Clear();
+	this->cells.clear();
+	this->queryStamps.clear();
+	this->count = 0;
+}
+
+void SpatialHash::Insert(int id, double x, double y, int width, int height)
+{
+#if _DEBUG
+	assert(id >= 0);
+#endif
+
+	if (id >= static_cast<int>(this->entries.size()))
+	{
+		this->entries.resize(id + 1, Entry{ 0, 0, -1, -1, false });
+		this->bounds.lefts.resize(id + 1, 0);
+		this->bounds.tops.resize(id + 1, 0);
+		this->bounds.rights.resize(id + 1, 0);
+		this->bounds.bottoms.resize(id + 1, 0);
+		this->queryStamps.resize(id + 1, 0);
+	}
+
+	Entry& entry = this->entries[id];
+
+#if _DEBUG
+	assert(!entry.isInserted);	//use Update() to move it
+#endif
+
+	CollisionKernel::GetEdges(x, y, width, height, this->bounds.lefts[id], this->bounds.tops[id], this->bounds.rights[id], this->bounds.bottoms[id]);
+	this->getCells(this->bounds.lefts[id], this->bounds.tops[id], this->bounds.rights[id], this->bounds.bottoms[id], entry.firstCellX, entry.firstCellY, entry.lastCellX, entry.lastCellY);
+	entry.isInserted = true;
+	this->addToCells(id);
+	this->count++;
+}
+
+void SpatialHash::Update(int id, double x, double y, int width, int height)
+{
+#if _DEBUG
+	assert(id >= 0 && id < static_cast<int>(this->entries.size()) && this->entries[id].isInserted);
+#endif
+
+	CollisionKernel::GetEdges(x, y, width, height, this->bounds.lefts[id], this->bounds.tops[id], this->bounds.rights[id], this->bounds.bottoms[id]);
+
+	Entry& entry = this->entries[id];
+	Entry moved = entry;
+	this->getCells(this->bounds.lefts[id], this->bounds.tops[id], this->bounds.rights[id], this->bounds.bottoms[id], moved.firstCellX, moved.firstCellY, moved.lastCellX, moved.lastCellY);
+
+	//most moves stay inside the same cells, then only the bounds change
+	if (moved.firstCellX == entry.firstCellX && moved.firstCellY == entry.firstCellY && moved.lastCellX == entry.lastCellX && moved.lastCellY == entry.lastCellY)
+		return;
+
+	this->removeFromCells(id);
+	entry = moved;
+	this->addToCells(id);
+}
+
+void SpatialHash::Remove(int id)
+{
+	if (id < 0 || id >= static_cast<int>(this->entries.size()) || !this->entries[id].isInserted)
+		return;
+
+	this->removeFromCells(id);
+	this->entries[id].isInserted = false;
+	this->count--;
+}
+
+void SpatialHash::QueryRect(double x, double y, int width, int height, std::vector<int>& results) const
+{
+	//every box overlapping this one, in id order
+	results.clear();
+
+	int left, top, right, bottom;
+	int firstCellX, firstCellY, lastCellX, lastCellY;
+	CollisionKernel::GetEdges(x, y, width, height, left, top, right, bottom);
+	this->getCells(left, top, right, bottom, firstCellX, firstCellY, lastCellX, lastCellY);
+
+	this->queryCells(firstCellX, firstCellY, lastCellX, lastCellY);
+
+	//test every candidate in one batch
+	this->candidateBounds.Clear();
+	for (int id : this->candidates)
+	{
+		this->candidateBounds.AddEdges(this->bounds.lefts[id], this->bounds.tops[id], this->bounds.rights[id], this->bounds.bottoms[id]);
+	}
+
+	CollisionKernel::TestOne(left, top, right, bottom, this->candidateBounds, 0, this->candidateBounds.GetCount(), this->hitMask);
+
+	for (int i = 0; i < this->candidateBounds.GetCount(); i++)
+	{
+		if (CollisionKernel::GetHit(this->hitMask, i))
+			results.push_back(this->candidates[i]);
+	}
+
+	std::sort(results.begin(), results.end());
+}
+
+void SpatialHash::QueryRadius(double x, double y, double radius, std::vector<int>& results) const
+{
+	//every box with some part strictly inside the circle, in id order
+	results.clear();
+
+	const int firstCellX = this->getCell(static_cast<int>(std::floor(x - radius)));
+	const int firstCellY = this->getCell(static_cast<int>(std::floor(y - radius)));
+	const int lastCellX = this->getCell(static_cast<int>(std::floor(x + radius)));
+	const int lastCellY = this->getCell(static_cast<int>(std::floor(y + radius)));
+
+	this->queryCells(firstCellX, firstCellY, lastCellX, lastCellY);
+
+	const double radiusSquared = radius * radius;
+	for (int id : this->candidates)
+	{
+		//closest point of the box to the centre
+		const double closestX = std::max(static_cast<double>(this->bounds.lefts[id]), std::min(x, static_cast<double>(this->bounds.rights[id])));
+		const double closestY = std::max(static_cast<double>(this->bounds.tops[id]), std::min(y, static_cast<double>(this->bounds.bottoms[id])));
+		const double distanceX = x - closestX;
+		const double distanceY = y - closestY;
+
+		if ((distanceX * distanceX) + (distanceY * distanceY) >= radiusSquared)
+			continue;
+
+		results.push_back(id);
+	}
+
+	std::sort(results.begin(), results.end());
+}
+
+void SpatialHash::QueryPairs(std::vector<std::pair<int, int>>& pairs) const
+{
+	//every pair of overlapping boxes, lower id first, each pair exactly once
+	pairs.clear();
+
+	for (const std::pair<const long long, std::vector<int>>& cell : this->cells)
+	{
+		const std::vector<int>& ids = cell.second;
+		const int count = static_cast<int>(ids.size());
+		if (count < 2)
+			continue;
+
+		this->candidateBounds.Clear();
+		for (int id : ids)
+		{
+			this->candidateBounds.AddEdges(this->bounds.lefts[id], this->bounds.tops[id], this->bounds.rights[id], this->bounds.bottoms[id]);
+		}
+
+		//each box against everything after it in the cell, in one batch
+		for (int i = 0; i < count - 1; i++)
+		{
+			const Entry& a = this->entries[ids[i]];
+			CollisionKernel::TestOne(this->candidateBounds.lefts[i], this->candidateBounds.tops[i], this->candidateBounds.rights[i], this->candidateBounds.bottoms[i], this->candidateBounds, i + 1, count - i - 1, this->hitMask);
+
+			for (int j = i + 1; j < count; j++)
+			{
+				if (!CollisionKernel::GetHit(this->hitMask, j - i - 1))
+					continue;
+
+				const Entry& b = this->entries[ids[j]];
+
+				//boxes sharing several cells meet in all of them, only report the pair from the top left one they share
+				const int sharedCellX = std::max(a.firstCellX, b.firstCellX);
+				const int sharedCellY = std::max(a.firstCellY, b.firstCellY);
+				if (cell.first != this->getCellKey(sharedCellX, sharedCellY))
+					continue;
+
+				pairs.push_back(ids[i] < ids[j] ? std::make_pair(ids[i], ids[j]) : std::make_pair(ids[j], ids[i]));
+			}
+		}
+	}
+
+	std::sort(pairs.begin(), pairs.end());
+}
+
+int SpatialHash::GetCellSize() const
+{
+	return this->cellSize;
+}
+
+int SpatialHash::GetCount() const
+{
+	return this->count;
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+void SpatialHash::getCells(int left, int top, int right, int bottom, int& firstCellX, int& firstCellY, int& lastCellX, int& lastCellY) const
+{
+	//right and bottom edges are exclusive
+	firstCellX = this->getCell(left);
+	firstCellY = this->getCell(top);
+	lastCellX = this->getCell(std::max(left, right - 1));
+	lastCellY = this->getCell(std::max(top, bottom - 1));
+}
+
+void SpatialHash::addToCells(int id)
+{
+	const Entry& entry = this->entries[id];
+
+	for (int cellY = entry.firstCellY; cellY <= entry.lastCellY; cellY++)
+	{
+		for (int cellX = entry.firstCellX; cellX <= entry.lastCellX; cellX++)
+		{
+			this->cells[this->getCellKey(cellX, cellY)].push_back(id);
+		}
+	}
+}
+
+void SpatialHash::removeFromCells(int id)
+{
+	const Entry& entry = this->entries[id];
+
+	for (int cellY = entry.firstCellY; cellY <= entry.lastCellY; cellY++)
+	{
+		for (int cellX = entry.firstCellX; cellX <= entry.lastCellX; cellX++)
+		{
+			std::unordered_map<long long, std::vector<int>>::iterator cell = this->cells.find(this->getCellKey(cellX, cellY));
+
+#if _DEBUG
+			assert(cell != this->cells.end());
+#endif
+
+			if (cell == this->cells.end())
+				continue;
+
+			//order within a cell doesn't matter, so swap with the last one instead of shifting everything down
+			std::vector<int>& ids = cell->second;
+			std::vector<int>::iterator it = std::find(ids.begin(), ids.end(), id);
+			if (it != ids.end())
+			{
+				*it = ids.back();
+				ids.pop_back();
+			}
+
+			//emptied cells are kept (there are at most as many as the map has room for), so entities moving back in or respawning don't allocate
+		}
+	}
+}
+
+void SpatialHash::queryCells(int firstCellX, int firstCellY, int lastCellX, int lastCellY) const
+{
+	this->candidates.clear();
+	this->queryStamp++;
+
+	for (int cellY = firstCellY; cellY <= lastCellY; cellY++)
+	{
+		for (int cellX = firstCellX; cellX <= lastCellX; cellX++)
+		{
+			std::unordered_map<long long, std::vector<int>>::const_iterator cell = this->cells.find(this->getCellKey(cellX, cellY));
+			if (cell == this->cells.end())
+				continue;
+
+			for (int id : cell->second)
+			{
+				if (this->queryStamps[id] == this->queryStamp)
+					continue;
+
+				this->queryStamps[id] = this->queryStamp;
+				this->candidates.push_back(id);
+			}
+		}
+	}
+}
+
+int SpatialHash::getCell(int position) const
+{
+	//rounds towards negative infinity, so cells stay the same size left of and above the map too
+	return (position >= 0) ? (position / this->cellSize) : -(((-position) + this->cellSize - 1) / this->cellSize);
+}
+
+long long SpatialHash::getCellKey(int cellX, int cellY) const
+{
+	return (static_cast<long long>(cellY) << 32) | static_cast<unsigned int>(cellX);
+}
+
+#pragma endregion
\ No newline at end of file
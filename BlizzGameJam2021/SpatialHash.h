@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CollisionKernel.h"
+#include <vector>
+#include <unordered_map>
+#include <utility>
+
+//broadphase for boxes moving around the map: a uniform grid of cellSize squares lined up with the tiles
+//boxes are positioned by their centre like Object and tested with CollisionKernel, so touching edges don't count as overlapping
+class SpatialHash
+{
+public:
+	SpatialHash(int cellSize);
+
+	void Clear();
+	void Insert(int id, double x, double y, int width, int height);
+	void Update(int id, double x, double y, int width, int height);
+	void Remove(int id);
+
+	void QueryRect(double x, double y, int width, int height, std::vector<int>& results) const;
+	void QueryRadius(double x, double y, double radius, std::vector<int>& results) const;
+	void QueryPairs(std::vector<std::pair<int, int>>& pairs) const;
+
+	int GetCellSize() const;
+	int GetCount() const;
+
+private:
+	//which cells a box covers, its edges live in bounds
+	struct Entry
+	{
+		int firstCellX;
+		int firstCellY;
+		int lastCellX;
+		int lastCellY;
+		bool isInserted;
+	};
+
+	void getCells(int left, int top, int right, int bottom, int& firstCellX, int& firstCellY, int& lastCellX, int& lastCellY) const;
+	void addToCells(int id);
+	void removeFromCells(int id);
+	void queryCells(int firstCellX, int firstCellY, int lastCellX, int lastCellY) const;
+	int getCell(int position) const;
+	long long getCellKey(int cellX, int cellY) const;
+
+	const int cellSize;
+	int count = 0;
+	std::vector<Entry> entries;									//indexed by id
+	PackedBoxes bounds;											//indexed by id, packed so queries can hand them straight to CollisionKernel
+	std::unordered_map<long long, std::vector<int>> cells;		//ids of every entry overlapping each cell, by getCellKey()
+
+	//scratch for queries, a box spanning several cells is only collected once per query
+	mutable std::vector<int> candidates;
+	mutable PackedBoxes candidateBounds;
+	mutable std::vector<unsigned int> hitMask;
+	mutable std::vector<unsigned int> queryStamps;				//indexed by id
+	mutable unsigned int queryStamp = 0;
+};
\ No newline at end of file
@@ -1,5 +1,15 @@
 #include "Teleporter.h"
 #include "Object.h"
+#include "Constants.h"
+#include "CollisionKernel.h"
+#include <fstream>
+#include <cstring>
+
+#ifndef _WIN32
+	//posix names for the msvc string functions the spawn and teleporter files are parsed with
+	#define _strdup strdup
+	#define strtok_s strtok_r
+#endif
 
 #if _DEBUG
 	#include <assert.h>
@@ -7,7 +17,7 @@
 
 #pragma region Constructor
 
-Teleporter::Teleporter(int x, int y, int width, int height, const std::vector<std::string>& destinationMapFilePathsByLayer, const std::string& destinationMapTextureFilePath, const std::string& destinationTeleportersFilePath, const std::string& destinationSpawnsFilePath, int destinationX, int destinationY)
+Teleporter::Teleporter(int x, int y, int width, int height, MapHandle destinationMap, int destinationX, int destinationY)
 {
 	this->x = x;
 	this->y = y;
@@ -15,10 +25,7 @@ Teleporter::Teleporter(int x, int y, int width, int height, const std::vector<st
 	this->height = height;
 	this->destination = 
 	{
-		destinationMapFilePathsByLayer,
-		destinationMapTextureFilePath,
-		destinationTeleportersFilePath,
-		destinationSpawnsFilePath,
+		destinationMap,
 		destinationX,
 		destinationY
 	};
@@ -40,54 +47,103 @@ bool Teleporter::TestCollision(const Object* otherObject) const
 	assert(this->height);
 #endif
 
-	const int thisHalfWidth = this->width / 2;
-	const int thisHalfHeight = this->height / 2;
-	const int otherHalfWidth = otherObject->GetWidth() / 2;
-	const int otherHalfHeight = otherObject->GetHeight() / 2;
-
-	//The sides of the rectangles
-	int leftA, leftB;
-	int rightA, rightB;
-	int topA, topB;
-	int bottomA, bottomB;
-
-	//Calculate the sides of rect A
-	leftA = this->x - thisHalfWidth;
-	rightA = this->x + thisHalfWidth;
-	topA = this->y - thisHalfHeight;
-	bottomA = this->y + thisHalfHeight;
-
-	//Calculate the sides of rect B
-	leftB = otherObject->GetPositionX() - otherHalfWidth;
-	rightB = otherObject->GetPositionX() + otherHalfWidth;
-	topB = otherObject->GetPositionY() - otherHalfHeight;
-	bottomB = otherObject->GetPositionY() + otherHalfHeight;
-
-	//If any of the sides from A are outside of B
-	if (bottomA <= topB)
-	{
-		return false;
-	}
+	int leftA, topA, rightA, bottomA;
+	int leftB, topB, rightB, bottomB;
+	CollisionKernel::GetEdges(this->x, this->y, this->width, this->height, leftA, topA, rightA, bottomA);
+	CollisionKernel::GetEdges(otherObject->GetPositionX(), otherObject->GetPositionY(), otherObject->GetWidth(), otherObject->GetHeight(), leftB, topB, rightB, bottomB);
 
-	if (topA >= bottomB)
-	{
-		return false;
-	}
+	return CollisionKernel::TestEdges(leftA, topA, rightA, bottomA, leftB, topB, rightB, bottomB);
+}
 
-	if (rightA <= leftB)
-	{
+bool Teleporter::ReadFile(const std::string& filepath, std::vector<Teleporter>& teleporters)
+{
+	std::ifstream file(filepath.c_str());
+
+	if (!file.is_open())
 		return false;
-	}
 
-	if (leftA >= rightB)
+	std::string line;
+	while (std::getline(file, line))
 	{
-		return false;
+		if (line.length() < 2)
+			continue;
+
+		//skip comment lines
+		if (line[0] == '-' && line[1] == '-')
+			continue;
+
+		char* l = _strdup(line.c_str());
+
+		char* context = nullptr;
+
+		char* xPosToken = strtok_s(l, ";", &context);
+		char* yPosToken = strtok_s(nullptr, ";", &context);
+		char* destinationMapNameToken = strtok_s(nullptr, ";", &context);
+		char* destinationXToken = strtok_s(nullptr, ";", &context);
+		char* destinationYToken = strtok_s(nullptr, ";", &context);
+
+		if ((xPosToken == nullptr) ||
+			(yPosToken == nullptr) ||
+			(destinationMapNameToken == nullptr) ||
+			(destinationXToken == nullptr) ||
+			(destinationYToken == nullptr))
+		{
+			free(l);
+			return false;
+		}
+
+		int xPos = atoi(xPosToken);
+		int yPos = atoi(yPosToken);
+		std::string destinationMapName = destinationMapNameToken;
+		int destinationX = atoi(destinationXToken);
+		int destinationY = atoi(destinationYToken);
+
+		//clear whitespace from destinationMapName
+		while (destinationMapName.size() && isspace(destinationMapName.front()))	//front
+			destinationMapName.erase(destinationMapName.begin());
+		while (destinationMapName.size() && isspace(destinationMapName.back()))	//back
+			destinationMapName.pop_back();
+
+		//resolved once here, switching maps later only passes the handle around
+		MapHandle destinationMap = MapRegistry::GetHandle(destinationMapName);
+		if (destinationMap == INVALID_MAP_HANDLE)
+		{
+			printf("Teleporter at (%d, %d) in %s leads to unknown map %s\n", xPos, yPos, filepath.c_str(), destinationMapName.c_str());
+			free(l);
+			return false;
+		}
+
+		//all done, build our teleporter and add it to the set
+		teleporters.emplace_back(xPos, yPos, TELEPORTER_WIDTH, TELEPORTER_HEIGHT, destinationMap, destinationX, destinationY);
+
+		free(l);
 	}
 
-	//If none of the sides from A are outside B
+	file.close();
+
 	return true;
 }
 
+int Teleporter::GetX() const
+{
+	return this->x;
+}
+
+int Teleporter::GetY() const
+{
+	return this->y;
+}
+
+int Teleporter::GetWidth() const
+{
+	return this->width;
+}
+
+int Teleporter::GetHeight() const
+{
+	return this->height;
+}
+
 const Destination& Teleporter::GetDestination() const
 {
 	return this->destination;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "MapRegistry.h"
 #include <vector>
 #include <string>
 
@@ -9,10 +10,7 @@ class Object;
 
 struct Destination
 {
-	std::vector<std::string> destinationMapFilePathsByLayer;
-	std::string destinationMapTextureFilePath;
-	std::string destinationTeleportersFilePath;
-	std::string destinationSpawnsFilePath;
+	MapHandle destinationMap;
 	int destinationX;
 	int destinationY;
 };
@@ -20,10 +18,16 @@ struct Destination
 class Teleporter
 {
 public:
-	Teleporter(int x, int y, int width, int height, const std::vector<std::string>& destinationMapFilePathsByLayer, const std::string& destinationMapTextureFilePath, const std::string& destinationTeleportersFilePath, const std::string& destinationSpawnsFilePath, int destinationX, int destinationY);
+	Teleporter(int x, int y, int width, int height, MapHandle destinationMap, int destinationX, int destinationY);
 	~Teleporter();
 
+	static bool ReadFile(const std::string& filepath, std::vector<Teleporter>& teleporters);
+
 	bool TestCollision(const Object* otherObject) const;
+	int GetX() const;
+	int GetY() const;
+	int GetWidth() const;
+	int GetHeight() const;
 	const Destination& GetDestination() const;
 
 private:
@@ -2,6 +2,7 @@
 #include "Display.h"
 #include "SDL_image.h"
 #include "SDL_ttf.h"
+#include "Constants.h"
 
 #ifdef _DEBUG
 #include <assert.h>
@@ -16,6 +17,7 @@ const Uint8 opacityB = 0x00;
 Texture::Texture(const std::string& path)
 {
 	this->path = path;
+	this->sdl_texture = nullptr;
 	this->isLoaded = false;
 	this->isForText = false;
 	this->renderOffsetX = this->width;
@@ -33,6 +35,13 @@ Texture::Texture()
 
 Texture::~Texture()
 {
+	//decoded off the render thread but never uploaded
+	if (this->decodedSurface)
+	{
+		SDL_FreeSurface(this->decodedSurface);
+		this->decodedSurface = nullptr;
+	}
+
 	//Free texture if it exists
 	if (this->isLoaded)
 	{
@@ -77,19 +86,61 @@ Texture* Texture::CreateFromText(const std::string& text, SDL_Color textColor, F
 	return t;
 }
 
+Texture* Texture::CreateRenderTarget(int width, int height)
+{
+	Texture* t = new Texture();
+	t->isLoaded = false;
+	t->isForText = false;
+	t->renderOffsetX = 0;
+	t->renderOffsetY = 0;
+
+	t->sdl_texture = SDL_CreateTexture(Display::GetRenderer(), SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+	if (t->sdl_texture == nullptr)
+	{
+		printf("Unable to create render target texture! SDL Error: %s\n", SDL_GetError());
+		delete t;
+		return nullptr;
+	}
+
+	//whatever isn't drawn into stays transparent so layers underneath show through
+	SDL_SetTextureBlendMode(t->sdl_texture, SDL_BLENDMODE_BLEND);
+
+	t->width = width;
+	t->height = height;
+	t->isLoaded = true;
+
+	return t;
+}
+
+void Texture::EndRenderTarget()
+{
+	SDL_Renderer* renderer = Display::GetRenderer();
+
+	//back to drawing on screen
+	SDL_SetRenderTarget(renderer, nullptr);
+	SDL_RenderSetScale(renderer, RENDER_SCALE_AMOUNT, RENDER_SCALE_AMOUNT);
+}
+
 bool Texture::Load()
 {
 	if (this->isLoaded)
 		return true;
 
-	//clear any texture we already have loaded
-	if (this->sdl_texture)
-	{
-		SDL_DestroyTexture(this->sdl_texture);
-		this->sdl_texture = nullptr;
-		this->width = 0;
-		this->height = 0;
-	}
+	if (!this->Decode())
+		return false;
+
+	//only the render thread can create SDL textures, anyone else has to leave the Upload() to it
+	if (!Display::IsRenderThread())
+		return true;
+
+	return this->Upload();
+}
+
+bool Texture::Decode()
+{
+	//file i/o and image decoding only, safe to do off the render thread
+	if (this->isLoaded || this->decodedSurface)
+		return true;
 
 	//Load image at specified path
 	SDL_Surface* loadedSurface = IMG_Load(path.c_str());
@@ -102,8 +153,48 @@ bool Texture::Load()
 	//Color key image
 	SDL_SetColorKey(loadedSurface, SDL_TRUE, SDL_MapRGB(loadedSurface->format, opacityR, opacityG, opacityB));
 
+	this->decodedSurface = loadedSurface;
+
+	return true;
+}
+
+bool Texture::Upload()
+{
+#ifdef _DEBUG
+	assert(Display::IsRenderThread());
+#endif
+
+	if (this->isLoaded)
+		return true;
+
+	if (!this->decodedSurface && !this->Decode())
+		return false;
+
+	//no renderer to upload to, but keep the size so everything sized off the texture still works
+	if (Display::GetIsHeadless())
+	{
+		this->width = this->decodedSurface->w;
+		this->height = this->decodedSurface->h;
+
+		SDL_FreeSurface(this->decodedSurface);
+		this->decodedSurface = nullptr;
+
+		this->isLoaded = true;
+
+		return true;
+	}
+
+	//clear any texture we already have loaded
+	if (this->sdl_texture)
+	{
+		SDL_DestroyTexture(this->sdl_texture);
+		this->sdl_texture = nullptr;
+		this->width = 0;
+		this->height = 0;
+	}
+
 	//Create texture from surface pixels
-	this->sdl_texture = SDL_CreateTextureFromSurface(Display::GetRenderer(), loadedSurface);
+	this->sdl_texture = SDL_CreateTextureFromSurface(Display::GetRenderer(), this->decodedSurface);
 	if (this->sdl_texture == nullptr)
 	{
 		printf("Unable to create texture from %s! SDL Error: %s\n", path.c_str(), SDL_GetError());
@@ -111,17 +202,40 @@ bool Texture::Load()
 	}
 
 	//Get image dimensions
-	this->width = loadedSurface->w;
-	this->height = loadedSurface->h;
+	this->width = this->decodedSurface->w;
+	this->height = this->decodedSurface->h;
 
 	//Get rid of old loaded surface
-	SDL_FreeSurface(loadedSurface);
+	SDL_FreeSurface(this->decodedSurface);
+	this->decodedSurface = nullptr;
 
 	this->isLoaded = true;
 
 	return true;
 }
 
+bool Texture::BeginRenderTarget()
+{
+#ifdef _DEBUG
+	assert(this->isLoaded);
+#endif
+
+	SDL_Renderer* renderer = Display::GetRenderer();
+
+	if (SDL_SetRenderTarget(renderer, this->sdl_texture) != 0)
+	{
+		printf("Unable to set render target! SDL Error: %s\n", SDL_GetError());
+		return false;
+	}
+
+	//draw in texture pixels, starting from fully transparent, until EndRenderTarget()
+	SDL_RenderSetScale(renderer, 1.0f, 1.0f);
+	SDL_SetRenderDrawColor(renderer, 0x00, 0x00, 0x00, 0x00);
+	SDL_RenderClear(renderer);
+
+	return true;
+}
+
 void Texture::Draw(int x, int y, bool shiftToCenter, SDL_Rect* clip /*= nullptr*/, double angle /*= 0.0*/, SDL_Point* center /*= nullptr*/, SDL_RendererFlip flip /*= SDL_FLIP_NONE*/) const
 {
 #ifdef _DEBUG
@@ -144,6 +258,25 @@ void Texture::Draw(int x, int y, bool shiftToCenter, SDL_Rect* clip /*= nullptr*
 	SDL_RenderCopyEx(Display::GetRenderer(), this->sdl_texture, clip, &renderQuad, angle, center, flip);
 }
 
+void Texture::DrawTiles(const SDL_Rect* sourceRects, const TileDrawCommand* commands, int commandCount) const
+{
+#ifdef _DEBUG
+	assert(this->isLoaded);
+#endif
+
+	SDL_Renderer* renderer = Display::GetRenderer();
+
+	//no rotation or flipping for map tiles, so plain copies straight from the precomputed source rects
+	for (int i = 0; i < commandCount; i++)
+	{
+		const TileDrawCommand& command = commands[i];
+		const SDL_Rect& sourceRect = sourceRects[command.sourceRectIndex];
+		const SDL_Rect renderQuad = { command.x, command.y, sourceRect.w, sourceRect.h };
+
+		SDL_RenderCopy(renderer, this->sdl_texture, &sourceRect, &renderQuad);
+	}
+}
+
 void Texture::SetRenderOffset(int offsetX, int offsetY)
 {
 	this->renderOffsetX = offsetX;
@@ -165,4 +298,21 @@ int Texture::GetHeight() const
 	return this->height;
 }
 
+bool Texture::GetIsLoaded() const
+{
+	return this->isLoaded;
+}
+
+size_t Texture::GetByteCount() const
+{
+	//roughly what holding on to this texture costs, 4 bytes per pixel once it's on the GPU
+	if (this->decodedSurface)
+		return static_cast<size_t>(this->decodedSurface->pitch) * this->decodedSurface->h;
+
+	if (this->sdl_texture)
+		return static_cast<size_t>(this->width) * this->height * 4;
+
+	return 0;
+}
+
 #pragma endregion
\ No newline at end of file
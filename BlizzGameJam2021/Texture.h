@@ -4,7 +4,8 @@
 #include <string>
 
 #pragma region Forward Declarations
-enum FontSize;
+enum FontSize : int;
+struct TileDrawCommand;
 #pragma endregion
 
 class Texture
@@ -14,9 +15,15 @@ public:
 	~Texture();
 
 	static Texture* CreateFromText(const std::string& text, SDL_Color textColor, FontSize fontSize);
+	static Texture* CreateRenderTarget(int width, int height);
+	static void EndRenderTarget();
 
 	bool Load();
+	bool Decode();
+	bool Upload();
+	bool BeginRenderTarget();
 	void Draw(int x, int y, bool shiftToCenter, SDL_Rect* clip = nullptr, double angle = 0.0, SDL_Point* center = nullptr, SDL_RendererFlip flip = SDL_FLIP_NONE) const;
+	void DrawTiles(const SDL_Rect* sourceRects, const TileDrawCommand* commands, int commandCount) const;
 
 	void SetRenderOffset(int offsetX, int offsetY);
 
@@ -24,11 +31,14 @@ public:
 
 	int GetWidth() const;
 	int GetHeight() const;
+	bool GetIsLoaded() const;
+	size_t GetByteCount() const;
 
 private:
 	Texture();	//for use with CreateFromText()
 
 	bool isLoaded;
+	SDL_Surface* decodedSurface = nullptr;		//between Decode() and Upload()
 	int width;
 	int height;
 	std::string path;
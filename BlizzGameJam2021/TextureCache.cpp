@@ -0,0 +1,124 @@
+#include "TextureCache.h"
+#include "Texture.h"
+#include "Display.h"
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Public Methods
+
+Texture* TextureCache::Acquire(const std::string& path)
+{
+	//held while decoding too, so two maps loading at once never decode the same file twice
+	std::lock_guard<std::mutex> lock(TextureCache::cacheMutex);
+
+	const std::unordered_map<std::string, CachedTexture>::iterator it = TextureCache::texturesByPath.find(path);
+	if (it != TextureCache::texturesByPath.end())
+	{
+		TextureCache::hits++;
+
+		//decoded by a background load, whoever needs it first on the render thread does the upload
+		if (Display::IsRenderThread() && !it->second.texture->GetIsLoaded() && !it->second.texture->Upload())
+		{
+			printf("Unable to upload texture %s\n", path.c_str());
+			return nullptr;
+		}
+
+		it->second.refCount++;
+
+		return it->second.texture;
+	}
+
+	TextureCache::misses++;
+
+	//decodes right away, uploads too if we're on the render thread (otherwise the owner's FinishLoading() or Upload() does that later)
+	Texture* texture = new Texture(path);
+	if (!texture->Load())
+	{
+		delete texture;
+		return nullptr;
+	}
+
+	TextureCache::texturesByPath[path] = { texture, 1 };
+	TextureCache::pathsByTexture[texture] = path;
+
+	return texture;
+}
+
+void TextureCache::Release(const Texture* texture)
+{
+	if (texture == nullptr)
+		return;
+
+	std::lock_guard<std::mutex> lock(TextureCache::cacheMutex);
+
+	const std::unordered_map<const Texture*, std::string>::iterator pathIt = TextureCache::pathsByTexture.find(texture);
+
+#if _DEBUG
+	assert(pathIt != TextureCache::pathsByTexture.end());	//not one of ours, or released too many times
+#endif
+
+	if (pathIt == TextureCache::pathsByTexture.end())
+		return;
+
+	const std::unordered_map<std::string, CachedTexture>::iterator it = TextureCache::texturesByPath.find(pathIt->second);
+	it->second.refCount--;
+
+	if (it->second.refCount > 0)
+		return;
+
+	//last user is gone
+	delete it->second.texture;
+	TextureCache::texturesByPath.erase(it);
+	TextureCache::pathsByTexture.erase(pathIt);
+}
+
+void TextureCache::ShutDown()
+{
+	std::lock_guard<std::mutex> lock(TextureCache::cacheMutex);
+
+#if _DEBUG
+	printf("Texture cache: %u hits, %u misses\n", TextureCache::hits, TextureCache::misses);
+#endif
+
+	//anything still here was never released, free it anyway before the renderer goes away
+	for (std::pair<const std::string, CachedTexture>& entry : TextureCache::texturesByPath)
+	{
+		printf("Texture %s still has %d reference(s) at shutdown\n", entry.first.c_str(), entry.second.refCount);
+		delete entry.second.texture;
+	}
+
+	TextureCache::texturesByPath.clear();
+	TextureCache::pathsByTexture.clear();
+}
+
+TextureCacheStats TextureCache::GetStats()
+{
+	std::lock_guard<std::mutex> lock(TextureCache::cacheMutex);
+
+	TextureCacheStats stats = {};
+	stats.hits = TextureCache::hits;
+	stats.misses = TextureCache::misses;
+	stats.residentTextures = TextureCache::texturesByPath.size();
+
+	for (const std::pair<const std::string, CachedTexture>& entry : TextureCache::texturesByPath)
+	{
+		if (entry.second.texture->GetIsLoaded())
+			stats.residentGpuBytes += entry.second.texture->GetByteCount();
+	}
+
+	return stats;
+}
+
+#pragma endregion
+
+#pragma region Static Member Initialization
+
+std::unordered_map<std::string, TextureCache::CachedTexture> TextureCache::texturesByPath;
+std::unordered_map<const Texture*, std::string> TextureCache::pathsByTexture;
+unsigned int TextureCache::hits = 0;
+unsigned int TextureCache::misses = 0;
+std::mutex TextureCache::cacheMutex;
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <mutex>
+
+#pragma region Forward Declarations
+class Texture;
+#pragma endregion
+
+struct TextureCacheStats
+{
+	unsigned int hits;
+	unsigned int misses;
+	unsigned int residentTextures;
+	size_t residentGpuBytes;		//uploaded textures only, ones still waiting for the render thread don't count yet
+};
+
+//every image file is decoded and uploaded once, everyone using it shares the same Texture until the last of them releases it
+class TextureCache
+{
+public:
+	TextureCache() = delete;
+
+	static Texture* Acquire(const std::string& path);
+	static void Release(const Texture* texture);
+	static void ShutDown();
+
+	static TextureCacheStats GetStats();
+
+private:
+	struct CachedTexture
+	{
+		Texture* texture;
+		int refCount;
+	};
+
+	static std::unordered_map<std::string, CachedTexture> texturesByPath;
+	static std::unordered_map<const Texture*, std::string> pathsByTexture;	//so Release() doesn't need the path
+	static unsigned int hits;
+	static unsigned int misses;
+	static std::mutex cacheMutex;		//guards all of the above, maps and their spawns can load on a background thread
+};
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "ThreadPool.h"
+#include "Constants.h"
+#include <algorithm>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Constructor
+
+ThreadPool::ThreadPool(int threadCount)
+{
+#if _DEBUG
+	assert(threadCount > 0);
+#endif
+
+	this->workers.reserve(threadCount);
+	for (int i = 0; i < threadCount; i++)
+	{
+		this->workers.emplace_back(&ThreadPool::workerLoop, this);
+	}
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+ThreadPool::~ThreadPool()
+{
+	//let whatever is queued finish first, jobs usually write into memory the caller owns
+	this->Wait();
+
+	{
+		std::lock_guard<std::mutex> lock(this->queueMutex);
+		this->stopRequested = true;
+	}
+	this->queueCondition.notify_all();
+
+	for (std::thread& worker : this->workers)
+	{
+		worker.join();
+	}
+}
+
+void ThreadPool::Enqueue(std::function<void()> job)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->queueMutex);
+		this->jobs.push_back(std::move(job));
+		this->outstandingJobCount++;
+	}
+	this->queueCondition.notify_one();
+}
+
+void ThreadPool::Wait()
+{
+	std::unique_lock<std::mutex> lock(this->queueMutex);
+	this->idleCondition.wait(lock, [this]() { return this->outstandingJobCount == 0; });
+}
+
+int ThreadPool::GetThreadCount() const
+{
+	return this->workers.size();
+}
+
+int ThreadPool::GetDefaultThreadCount()
+{
+	//hardware_concurrency() is allowed to return 0 when it can't tell
+	const int hardwareThreadCount = std::thread::hardware_concurrency();
+	return std::max(1, std::min(hardwareThreadCount, THREAD_POOL_MAX_THREADS));
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+void ThreadPool::workerLoop()
+{
+	while (true)
+	{
+		std::function<void()> job;
+
+		{
+			std::unique_lock<std::mutex> lock(this->queueMutex);
+			this->queueCondition.wait(lock, [this]() { return this->stopRequested || !this->jobs.empty(); });
+
+			if (this->jobs.empty())
+				return;
+
+			job = std::move(this->jobs.front());
+			this->jobs.pop_front();
+		}
+
+		job();
+
+		{
+			std::lock_guard<std::mutex> lock(this->queueMutex);
+			this->outstandingJobCount--;
+
+			if (this->outstandingJobCount == 0)
+				this->idleCondition.notify_all();
+		}
+	}
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+//fixed set of worker threads that run queued jobs, Wait() blocks until every queued job has finished
+class ThreadPool
+{
+public:
+	ThreadPool(int threadCount);
+	~ThreadPool();
+
+	void Enqueue(std::function<void()> job);
+	void Wait();
+
+	int GetThreadCount() const;
+
+	static int GetDefaultThreadCount();
+
+private:
+	void workerLoop();
+
+	std::vector<std::thread> workers;
+
+	//shared with the workers, guarded by queueMutex
+	std::mutex queueMutex;
+	std::condition_variable queueCondition;		//signalled when a job is queued or we're stopping
+	std::condition_variable idleCondition;		//signalled when the last outstanding job finishes
+	std::deque<std::function<void()>> jobs;
+	int outstandingJobCount = 0;				//queued plus running
+	bool stopRequested = false;
+};
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "TileCollider.h"
+#include "Map.h"
+#include "Constants.h"
+#include <cmath>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Public Methods
+
+TileCollision TileCollider::Move(const Map* map, double& x, double& y, int width, int height, double deltaX, double deltaY)
+{
+	//x/y is the centre of a width x height box, moved one axis at a time so hitting a wall on one still lets us slide along the other
+	//only the cells the leading edge actually crosses get tested, however far we move this frame, so nothing can tunnel through
+	//something that starts out stuck in a wall can still walk out of it, just not any further in
+#if _DEBUG
+	assert(map);
+#endif
+
+	TileCollision collision = { false, false };
+
+	const double halfWidth = width / 2.0;
+	const double halfHeight = height / 2.0;
+
+	if (deltaX != 0.0)
+	{
+		const int firstRow = TileCollider::getFirstCell(y - halfHeight, TILE_HEIGHT);
+		const int lastRow = TileCollider::getLastCell(y + halfHeight, TILE_HEIGHT);
+		collision.blockedX = TileCollider::sweepAxis(map, x, halfWidth, deltaX, firstRow, lastRow, TILE_WIDTH, true);
+	}
+
+	if (deltaY != 0.0)
+	{
+		const int firstColumn = TileCollider::getFirstCell(x - halfWidth, TILE_WIDTH);
+		const int lastColumn = TileCollider::getLastCell(x + halfWidth, TILE_WIDTH);
+		collision.blockedY = TileCollider::sweepAxis(map, y, halfHeight, deltaY, firstColumn, lastColumn, TILE_HEIGHT, false);
+	}
+
+	return collision;
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+bool TileCollider::sweepAxis(const Map* map, double& position, double halfSize, double delta, int firstCrossCell, int lastCrossCell, int cellSize, bool isHorizontal)
+{
+	//walk the leading edge cell by cell along the axis, stopping flush against the first line of cells (across the box) that isn't walkable
+	//off the map counts as not walkable, so this also keeps us in bounds
+	if (delta > 0.0)
+	{
+		const int fromCell = TileCollider::getLastCell(position + halfSize, cellSize);
+		const int toCell = TileCollider::getLastCell(position + halfSize + delta, cellSize);
+
+		//leading edge already inside something blocked, so don't push any deeper
+		if (!TileCollider::isLineWalkable(map, fromCell, firstCrossCell, lastCrossCell, isHorizontal))
+			return true;
+
+		for (int cell = fromCell + 1; cell <= toCell; cell++)
+		{
+			if (!TileCollider::isLineWalkable(map, cell, firstCrossCell, lastCrossCell, isHorizontal))
+			{
+				position = Map::GetTileStart(cell, cellSize) - halfSize;
+				return true;
+			}
+		}
+	}
+	else
+	{
+		const int fromCell = TileCollider::getFirstCell(position - halfSize, cellSize);
+		const int toCell = TileCollider::getFirstCell(position - halfSize + delta, cellSize);
+
+		if (!TileCollider::isLineWalkable(map, fromCell, firstCrossCell, lastCrossCell, isHorizontal))
+			return true;
+
+		for (int cell = fromCell - 1; cell >= toCell; cell--)
+		{
+			if (!TileCollider::isLineWalkable(map, cell, firstCrossCell, lastCrossCell, isHorizontal))
+			{
+				position = Map::GetTileStart(cell + 1, cellSize) + halfSize;
+				return true;
+			}
+		}
+	}
+
+	position += delta;
+
+	return false;
+}
+
+bool TileCollider::isLineWalkable(const Map* map, int cell, int firstCrossCell, int lastCrossCell, bool isHorizontal)
+{
+	//a column of cells for horizontal sweeps, a row for vertical ones
+	if (isHorizontal)
+		return map->IsWalkableRect(firstCrossCell, cell, lastCrossCell, cell);
+
+	return map->IsWalkableRect(cell, firstCrossCell, cell, lastCrossCell);
+}
+
+int TileCollider::getFirstCell(double minEdge, int cellSize)
+{
+	//the cell the box's top or left edge is in, cells are the map's tiles so they start half a cell before cell * cellSize
+	return Map::GetTileAt(minEdge, cellSize);
+}
+
+int TileCollider::getLastCell(double maxEdge, int cellSize)
+{
+	//the bottom or right edge is exclusive, a box ending exactly on a cell boundary doesn't touch the next cell
+	return static_cast<int>(std::ceil((maxEdge - Map::GetTileStart(0, cellSize)) / cellSize)) - 1;
+}
+
+#pragma endregion
\ No newline at end of file
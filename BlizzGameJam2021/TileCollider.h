@@ -0,0 +1,27 @@
+#pragma once
+
+#pragma region Forward Declarations
+class Map;
+#pragma endregion
+
+//which axes got stopped by a tile during a TileCollider::Move()
+struct TileCollision
+{
+	bool blockedX;
+	bool blockedY;
+};
+
+//swept box vs the map's walkable grid, used by everything that walks around the map
+class TileCollider
+{
+public:
+	TileCollider() = delete;
+
+	static TileCollision Move(const Map* map, double& x, double& y, int width, int height, double deltaX, double deltaY);
+
+private:
+	static bool sweepAxis(const Map* map, double& position, double halfSize, double delta, int firstCrossCell, int lastCrossCell, int cellSize, bool isHorizontal);
+	static bool isLineWalkable(const Map* map, int cell, int firstCrossCell, int lastCrossCell, bool isHorizontal);
+	static int getFirstCell(double minEdge, int cellSize);
+	static int getLastCell(double maxEdge, int cellSize);
+};
\ No newline at end of file
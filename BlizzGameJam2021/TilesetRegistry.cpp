@@ -0,0 +1,191 @@
+#include "TilesetRegistry.h"
+#include "XmlReader.h"
+#include <stdio.h>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Public Methods
+
+TilesetHandle TilesetRegistry::Load(const std::string& tsxFilepath)
+{
+	//maps can be loaded on background threads, held for the whole parse so the same file is never parsed twice
+	std::lock_guard<std::mutex> lock(TilesetRegistry::registryMutex);
+
+	//already parsed, no i/o at all
+	const std::map<std::string, TilesetHandle>::const_iterator it = TilesetRegistry::handlesByKey.find(tsxFilepath);
+	if (it != TilesetRegistry::handlesByKey.end())
+		return it->second;
+
+	std::string text;
+	if (!XmlReader::ReadFile(tsxFilepath, text))
+	{
+		printf("Failed to open tileset: %s\n", tsxFilepath.c_str());
+		return INVALID_TILESET_HANDLE;
+	}
+
+	XmlReader reader(text);
+	XmlTag tag;
+	while (reader.NextTag(tag))
+	{
+		if (tag.name != "tileset" || tag.isClosing)
+			continue;
+
+		Tileset* tileset = new Tileset();
+		if (!TilesetRegistry::parse(reader, tag, XmlReader::GetDirectory(tsxFilepath), *tileset))
+		{
+			printf("Failed to parse tileset: %s\n", tsxFilepath.c_str());
+			delete tileset;
+			return INVALID_TILESET_HANDLE;
+		}
+
+		return TilesetRegistry::add(tsxFilepath, tileset);
+	}
+
+	printf("No tileset found in: %s\n", tsxFilepath.c_str());
+	return INVALID_TILESET_HANDLE;
+}
+
+TilesetHandle TilesetRegistry::LoadEmbedded(const std::string& key, XmlReader& reader, const XmlTag& tilesetTag, const std::string& directory)
+{
+	std::lock_guard<std::mutex> lock(TilesetRegistry::registryMutex);
+
+	const std::map<std::string, TilesetHandle>::const_iterator it = TilesetRegistry::handlesByKey.find(key);
+	if (it != TilesetRegistry::handlesByKey.end())
+	{
+		//still need to move the reader past it
+		Tileset skipped;
+		TilesetRegistry::parse(reader, tilesetTag, directory, skipped);
+
+		return it->second;
+	}
+
+	Tileset* tileset = new Tileset();
+	if (!TilesetRegistry::parse(reader, tilesetTag, directory, *tileset))
+	{
+		printf("Failed to parse embedded tileset: %s\n", key.c_str());
+		delete tileset;
+		return INVALID_TILESET_HANDLE;
+	}
+
+	return TilesetRegistry::add(key, tileset);
+}
+
+const Tileset& TilesetRegistry::Get(TilesetHandle handle)
+{
+	//tilesets are never moved or freed before ShutDown(), only the vector holding them can grow
+	std::lock_guard<std::mutex> lock(TilesetRegistry::registryMutex);
+
+#if _DEBUG
+	assert(handle >= 0 && handle < static_cast<int>(TilesetRegistry::tilesets.size()));
+#endif
+
+	return *TilesetRegistry::tilesets[handle];
+}
+
+void TilesetRegistry::ShutDown()
+{
+	std::lock_guard<std::mutex> lock(TilesetRegistry::registryMutex);
+
+	for (Tileset* tileset : TilesetRegistry::tilesets)
+	{
+		delete tileset;
+	}
+
+	TilesetRegistry::tilesets.clear();
+	TilesetRegistry::handlesByKey.clear();
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+bool TilesetRegistry::parse(XmlReader& reader, const XmlTag& tilesetTag, const std::string& directory, Tileset& tileset)
+{
+	tileset.name = tilesetTag.GetAttribute("name");
+	tileset.tileWidth = tilesetTag.GetIntAttribute("tilewidth");
+	tileset.tileHeight = tilesetTag.GetIntAttribute("tileheight");
+	tileset.columnCount = tilesetTag.GetIntAttribute("columns");
+	tileset.tileCount = tilesetTag.GetIntAttribute("tilecount");
+
+	if (tileset.columnCount <= 0 || tileset.tileCount <= 0)
+		return false;
+
+	const int margin = tilesetTag.GetIntAttribute("margin");
+	const int spacing = tilesetTag.GetIntAttribute("spacing");
+
+	tileset.sourceRects.resize(tileset.tileCount);
+	for (int id = 0; id < tileset.tileCount; id++)
+	{
+		const int column = id % tileset.columnCount;
+		const int row = id / tileset.columnCount;
+		tileset.sourceRects[id] = { margin + (column * (tileset.tileWidth + spacing)), margin + (row * (tileset.tileHeight + spacing)), tileset.tileWidth, tileset.tileHeight };
+	}
+
+	//tiles without a property keep the default (not walkable, not an object)
+	tileset.walkable.assign(tileset.tileCount, 0);
+	tileset.isObject.assign(tileset.tileCount, 0);
+
+	if (tilesetTag.isSelfClosing)
+		return false;
+
+	int currentTileId = -1;
+	XmlTag tag;
+	while (reader.NextTag(tag))
+	{
+		if (tag.isClosing)
+		{
+			if (tag.name == "tileset")
+				return !tileset.imageFilePath.empty();
+
+			if (tag.name == "tile")
+				currentTileId = -1;
+
+			continue;
+		}
+
+		if (tag.name == "image")
+		{
+			tileset.imageFilePath = directory + tag.GetAttribute("source");
+		}
+		else if (tag.name == "tile")
+		{
+			currentTileId = tag.GetIntAttribute("id", -1);
+			if (currentTileId < 0 || currentTileId >= tileset.tileCount)
+				return false;
+		}
+		else if (tag.name == "property" && currentTileId >= 0)
+		{
+			const std::string propertyName = tag.GetAttribute("name");
+			const unsigned char value = tag.GetAttribute("value") == "true" ? 1 : 0;
+
+			if (propertyName == "walkable")
+				tileset.walkable[currentTileId] = value;
+			else if (propertyName == "isObject")
+				tileset.isObject[currentTileId] = value;
+		}
+	}
+
+	//ran out of file before </tileset>
+	return false;
+}
+
+TilesetHandle TilesetRegistry::add(const std::string& key, Tileset* tileset)
+{
+	const TilesetHandle handle = static_cast<TilesetHandle>(TilesetRegistry::tilesets.size());
+	TilesetRegistry::tilesets.push_back(tileset);
+	TilesetRegistry::handlesByKey.insert({ key, handle });
+
+	return handle;
+}
+
+#pragma endregion
+
+#pragma region Static Member Initialization
+
+std::vector<Tileset*> TilesetRegistry::tilesets;
+std::map<std::string, TilesetHandle> TilesetRegistry::handlesByKey;
+std::mutex TilesetRegistry::registryMutex;
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "SDL_rect.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+
+#pragma region Forward Declarations
+class XmlReader;
+struct XmlTag;
+#pragma endregion
+
+typedef int TilesetHandle;
+
+#define INVALID_TILESET_HANDLE	-1
+
+//one tileset's tile properties, flat arrays indexed by tile id (so tile id is also the index into the sprite sheet)
+struct Tileset
+{
+	std::string name;
+	std::string imageFilePath;
+	int tileWidth = 0;
+	int tileHeight = 0;
+	int columnCount = 0;
+	int tileCount = 0;
+	std::vector<unsigned char> walkable;
+	std::vector<unsigned char> isObject;
+	std::vector<SDL_Rect> sourceRects;		//where each tile sits in the tileset image, worked out once at load so drawing never has to
+};
+
+//parses each tileset once per process, maps then share it by handle
+class TilesetRegistry
+{
+public:
+	TilesetRegistry() = delete;
+
+	static TilesetHandle Load(const std::string& tsxFilepath);
+	static TilesetHandle LoadEmbedded(const std::string& key, XmlReader& reader, const XmlTag& tilesetTag, const std::string& directory);
+	static const Tileset& Get(TilesetHandle handle);
+	static void ShutDown();
+
+private:
+	static bool parse(XmlReader& reader, const XmlTag& tilesetTag, const std::string& directory, Tileset& tileset);
+	static TilesetHandle add(const std::string& key, Tileset* tileset);
+
+	static std::vector<Tileset*> tilesets;						//indexed by handle, never shrinks until ShutDown() so handles stay valid
+	static std::map<std::string, TilesetHandle> handlesByKey;	//file path (or map path + firstgid for tilesets embedded in a .tmx)
+	static std::mutex registryMutex;							//guards both of the above, maps can load on a background thread
+};
\ No newline at end of file
@@ -0,0 +1,415 @@
+#include "TmxLoader.h"
+#include "Inflate.h"
+#include "XmlReader.h"
+#include "TilesetRegistry.h"
+#include "MapRegistry.h"
+#include "Constants.h"
+#include <map>
+#include <cctype>
+#include <cstdlib>
+#include <stdio.h>
+
+#define TMX_GID_FLIP_FLAGS_MASK	0xE0000000	//horizontal, vertical and diagonal flip bits, flipped tiles aren't supported so they're ignored
+
+#pragma region Decoding Helpers
+
+namespace
+{
+	//6 bit value of every base64 character, -1 for everything else
+	struct Base64DecodeTable
+	{
+		signed char values[256];
+	};
+
+	Base64DecodeTable buildBase64DecodeTable()
+	{
+		const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+		Base64DecodeTable decodeTable;
+		for (int i = 0; i < 256; i++)
+			decodeTable.values[i] = -1;
+		for (int i = 0; i < 64; i++)
+			decodeTable.values[static_cast<unsigned char>(alphabet[i])] = i;
+
+		return decodeTable;
+	}
+
+	bool decodeBase64(const std::string& text, size_t start, size_t end, std::vector<unsigned char>& bytes)
+	{
+		//function local statics are initialized once and thread safe, .tmx maps can load on the loader thread and the main thread at once
+		static const Base64DecodeTable decodeTable = buildBase64DecodeTable();
+
+		bytes.reserve(bytes.size() + ((end - start) * 3) / 4);
+
+		unsigned int accumulator = 0;
+		int accumulatedBits = 0;
+		for (size_t i = start; i < end; i++)
+		{
+			const unsigned char c = text[i];
+			if (isspace(c))
+				continue;
+
+			if (c == '=')
+				break;
+
+			const signed char value = decodeTable.values[c];
+			if (value < 0)
+				return false;
+
+			accumulator = (accumulator << 6) | value;
+			accumulatedBits += 6;
+			if (accumulatedBits >= 8)
+			{
+				accumulatedBits -= 8;
+				bytes.push_back(static_cast<unsigned char>((accumulator >> accumulatedBits) & 0xff));
+			}
+		}
+
+		return true;
+	}
+
+	struct TmxTileset
+	{
+		int firstGid = 0;
+		TilesetHandle handle = INVALID_TILESET_HANDLE;
+	};
+
+	struct TmxObject
+	{
+		int id = 0;
+		std::string type;
+		double x = 0.0;
+		double y = 0.0;
+		double width = 0.0;
+		double height = 0.0;
+		std::map<std::string, std::string> properties;
+	};
+
+	bool appendTile(std::vector<MapTile>& mapTiles, unsigned int gid, int firstGid, const Tileset& tileset)
+	{
+		gid &= ~TMX_GID_FLIP_FLAGS_MASK;
+
+		//gid 0 means nothing painted in this cell
+		if (gid == 0)
+		{
+			mapTiles.emplace_back(tileset, DEFAULT_EMPTY_MAP_TILE_ID);
+			return true;
+		}
+
+		const int id = static_cast<int>(gid) - firstGid;
+		if (id < 0 || id >= tileset.tileCount)
+			return false;
+
+		mapTiles.emplace_back(tileset, id);
+		return true;
+	}
+
+	//decodes the text content of a <data> element straight into the layer's tiles
+	bool decodeLayerData(const std::string& text, size_t start, size_t end, const std::string& encoding, const std::string& compression, int firstGid, const Tileset& tileset, std::vector<MapTile>& mapTiles)
+	{
+		if (encoding == "csv")
+		{
+			unsigned int gid = 0;
+			bool inNumber = false;
+			for (size_t i = start; i < end; i++)
+			{
+				const char c = text[i];
+				if (c >= '0' && c <= '9')
+				{
+					gid = (gid * 10) + (c - '0');
+					inNumber = true;
+				}
+				else if (inNumber)
+				{
+					if (!appendTile(mapTiles, gid, firstGid, tileset))
+						return false;
+
+					gid = 0;
+					inNumber = false;
+				}
+			}
+
+			if (inNumber)
+				return appendTile(mapTiles, gid, firstGid, tileset);
+
+			return true;
+		}
+
+		if (encoding != "base64")
+		{
+			printf("Unsupported tmx layer encoding: %s\n", encoding.c_str());
+			return false;
+		}
+
+		std::vector<unsigned char> encodedBytes;
+		if (!decodeBase64(text, start, end, encodedBytes))
+			return false;
+
+		const std::vector<unsigned char>* layerBytes = &encodedBytes;
+
+		std::vector<unsigned char> inflatedBytes;
+		if (!compression.empty())
+		{
+			if (compression != "zlib" && compression != "gzip")
+			{
+				printf("Unsupported tmx layer compression: %s\n", compression.c_str());
+				return false;
+			}
+
+			inflatedBytes.reserve(mapTiles.capacity() * 4);
+			if (!Inflate::Decompress(encodedBytes.data(), encodedBytes.size(), inflatedBytes))
+				return false;
+
+			layerBytes = &inflatedBytes;
+		}
+
+		//little endian 32 bit gids
+		const std::vector<unsigned char>& bytes = *layerBytes;
+		for (size_t i = 0; i + 3 < bytes.size(); i += 4)
+		{
+			const unsigned int gid = bytes[i] | (bytes[i + 1] << 8) | (bytes[i + 2] << 16) | (static_cast<unsigned int>(bytes[i + 3]) << 24);
+			if (!appendTile(mapTiles, gid, firstGid, tileset))
+				return false;
+		}
+
+		return true;
+	}
+
+	bool getBoolProperty(const TmxObject& object, const char* name)
+	{
+		const std::map<std::string, std::string>::const_iterator it = object.properties.find(name);
+		return it != object.properties.end() && it->second == "true";
+	}
+
+	int getIntProperty(const TmxObject& object, const char* name)
+	{
+		const std::map<std::string, std::string>::const_iterator it = object.properties.find(name);
+		return it == object.properties.end() ? 0 : atoi(it->second.c_str());
+	}
+
+	std::string getStringProperty(const TmxObject& object, const char* name)
+	{
+		const std::map<std::string, std::string>::const_iterator it = object.properties.find(name);
+		return it == object.properties.end() ? "" : it->second;
+	}
+
+	//Tiled places tile (row, column) at pixel (column * TILE_WIDTH, row * TILE_HEIGHT) by its top left corner, the game centers it there instead
+	bool addObject(const TmxObject& object, const std::string& directory, TmxMapData& data)
+	{
+		const double centerX = object.x + (object.width / 2) - (TILE_WIDTH / 2);
+		const double centerY = object.y + (object.height / 2) - (TILE_HEIGHT / 2);
+
+		if (object.type == "teleporter")
+		{
+			const std::string destination = getStringProperty(object, "destination");
+			if (destination.empty())
+			{
+				printf("Teleporter object %d has no destination\n", object.id);
+				return false;
+			}
+
+			//destinations are map names from the manifest, resolved once here so switching maps only passes the handle around
+			const MapHandle destinationMap = MapRegistry::GetHandle(destination);
+			if (destinationMap == INVALID_MAP_HANDLE)
+			{
+				printf("Teleporter object %d leads to unknown map %s\n", object.id, destination.c_str());
+				return false;
+			}
+
+			data.teleporters.emplace_back(static_cast<int>(centerX), static_cast<int>(centerY), TELEPORTER_WIDTH, TELEPORTER_HEIGHT, destinationMap, getIntProperty(object, "destinationX"), getIntProperty(object, "destinationY"));
+		}
+		else if (object.type == "spawn")
+		{
+			const std::string texture = getStringProperty(object, "texture");
+			if (texture.empty())
+			{
+				printf("Spawn object %d has no texture\n", object.id);
+				return false;
+			}
+
+			data.spawns.push_back({ object.id, centerX, centerY, static_cast<int>(object.width), static_cast<int>(object.height), directory + texture, getIntProperty(object, "spriteSheetOffsetX"), getIntProperty(object, "spriteSheetOffsetY"), getBoolProperty(object, "shouldIdleMove"), getBoolProperty(object, "isEnemy") });
+		}
+
+		//anything else is editor-only (notes, guides...) and gets ignored
+		return true;
+	}
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+bool TmxLoader::IsTmxFile(const std::string& filepath)
+{
+	const size_t extensionLength = 4;
+	return filepath.size() > extensionLength && filepath.compare(filepath.size() - extensionLength, extensionLength, ".tmx") == 0;
+}
+
+bool TmxLoader::Load(const std::string& filepath, TmxMapData& data)
+{
+	std::string text;
+	if (!XmlReader::ReadFile(filepath, text))
+	{
+		printf("Failed to open tmx map: %s\n", filepath.c_str());
+		return false;
+	}
+
+	const std::string directory = XmlReader::GetDirectory(filepath);
+
+	TmxTileset tmxTileset;
+	TmxObject object;
+	bool insideObject = false;
+	bool insideXmlData = false;
+	std::vector<MapTile>* layerTiles = nullptr;
+
+	XmlReader reader(text);
+	XmlTag tag;
+	while (reader.NextTag(tag))
+	{
+		if (tag.isClosing)
+		{
+			if (tag.name == "data")
+			{
+				insideXmlData = false;
+
+				if (!layerTiles || static_cast<int>(layerTiles->size()) != data.rowCount * data.columnCount)
+				{
+					printf("Layer %d in %s doesn't match the map size\n", static_cast<int>(data.tilesByLayer.size()) - 1, filepath.c_str());
+					return false;
+				}
+			}
+			else if (tag.name == "object" && insideObject)
+			{
+				insideObject = false;
+				if (!addObject(object, directory, data))
+					return false;
+			}
+
+			continue;
+		}
+
+		if (tag.name == "map")
+		{
+			if (tag.GetAttribute("orientation") != "orthogonal" || tag.GetIntAttribute("infinite") != 0)
+			{
+				printf("Only fixed size orthogonal tmx maps are supported: %s\n", filepath.c_str());
+				return false;
+			}
+
+			if (tag.GetIntAttribute("tilewidth") != TILE_WIDTH || tag.GetIntAttribute("tileheight") != TILE_HEIGHT)
+			{
+				printf("Tmx tile size doesn't match TILE_WIDTH/TILE_HEIGHT: %s\n", filepath.c_str());
+				return false;
+			}
+
+			data.columnCount = tag.GetIntAttribute("width");
+			data.rowCount = tag.GetIntAttribute("height");
+		}
+		else if (tag.name == "tileset")
+		{
+			//Map draws from a single texture, so only one tileset per map
+			if (tmxTileset.firstGid != 0)
+			{
+				printf("Only one tileset per tmx map is supported: %s\n", filepath.c_str());
+				return false;
+			}
+
+			tmxTileset.firstGid = tag.GetIntAttribute("firstgid", 1);
+
+			//shared through the registry, so switching back to a map never parses its tileset again
+			const std::string source = tag.GetAttribute("source");
+			if (!source.empty())
+				tmxTileset.handle = TilesetRegistry::Load(directory + source);
+			else
+				tmxTileset.handle = TilesetRegistry::LoadEmbedded(filepath + "#" + std::to_string(tmxTileset.firstGid), reader, tag, directory);
+
+			if (tmxTileset.handle == INVALID_TILESET_HANDLE)
+				return false;
+
+			data.tilesetHandle = tmxTileset.handle;
+		}
+		else if (tag.name == "layer")
+		{
+			if (tmxTileset.handle == INVALID_TILESET_HANDLE)
+			{
+				printf("Tmx layer found before its tileset: %s\n", filepath.c_str());
+				return false;
+			}
+
+			if (tag.GetIntAttribute("width") != data.columnCount || tag.GetIntAttribute("height") != data.rowCount)
+			{
+				printf("Layer '%s' in %s doesn't match the map size\n", tag.GetAttribute("name").c_str(), filepath.c_str());
+				return false;
+			}
+
+			data.tilesByLayer.emplace_back();
+			layerTiles = &data.tilesByLayer.back();
+			layerTiles->reserve(data.rowCount * data.columnCount);
+		}
+		else if (tag.name == "data" && layerTiles && !tag.isSelfClosing)
+		{
+			const std::string encoding = tag.GetAttribute("encoding");
+
+			//no encoding means one <tile gid=".."/> element per cell
+			if (encoding.empty())
+			{
+				insideXmlData = true;
+				continue;
+			}
+
+			const size_t contentStart = reader.GetPosition();
+			const size_t contentEnd = text.find('<', contentStart);
+			if (contentEnd == std::string::npos)
+				return false;
+
+			if (!decodeLayerData(text, contentStart, contentEnd, encoding, tag.GetAttribute("compression"), tmxTileset.firstGid, TilesetRegistry::Get(tmxTileset.handle), *layerTiles))
+			{
+				printf("Failed to decode layer %d in %s\n", static_cast<int>(data.tilesByLayer.size()) - 1, filepath.c_str());
+				return false;
+			}
+
+			reader.SetPosition(contentEnd);
+		}
+		else if (tag.name == "tile" && insideXmlData)
+		{
+			if (!appendTile(*layerTiles, static_cast<unsigned int>(strtoul(tag.GetAttribute("gid", "0").c_str(), nullptr, 10)), tmxTileset.firstGid, TilesetRegistry::Get(tmxTileset.handle)))
+				return false;
+		}
+		else if (tag.name == "object")
+		{
+			object = TmxObject();
+			object.id = tag.GetIntAttribute("id");
+			object.type = tag.GetAttribute("class", tag.GetAttribute("type"));	//"type" was renamed to "class" in Tiled 1.9
+			object.x = tag.GetDoubleAttribute("x");
+			object.y = tag.GetDoubleAttribute("y");
+			object.width = tag.GetDoubleAttribute("width");
+			object.height = tag.GetDoubleAttribute("height");
+
+			if (tag.isSelfClosing)
+			{
+				if (!addObject(object, directory, data))
+					return false;
+			}
+			else
+			{
+				insideObject = true;
+			}
+		}
+		else if (tag.name == "property" && insideObject)
+		{
+			object.properties[tag.GetAttribute("name")] = tag.GetAttribute("value");
+		}
+	}
+
+	if (data.tilesByLayer.empty())
+	{
+		printf("Tmx map has no layers: %s\n", filepath.c_str());
+		return false;
+	}
+
+	data.textureFilePath = TilesetRegistry::Get(tmxTileset.handle).imageFilePath;
+
+	return true;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "MapTile.h"
+#include "Teleporter.h"
+#include "EntityStore.h"
+#include "TilesetRegistry.h"
+#include <string>
+#include <vector>
+
+//everything a Tiled .tmx map holds, decoded into the layouts the game uses at runtime
+struct TmxMapData
+{
+	int rowCount = 0;
+	int columnCount = 0;
+	TilesetHandle tilesetHandle = INVALID_TILESET_HANDLE;
+	std::string textureFilePath;
+	std::vector<std::vector<MapTile>> tilesByLayer;		//same dense row-major grids Map keeps, moved straight into it
+	std::vector<Teleporter> teleporters;
+	std::vector<SpawnDefinition> spawns;
+};
+
+class TmxLoader
+{
+public:
+	TmxLoader() = delete;
+
+	static bool IsTmxFile(const std::string& filepath);
+	static bool Load(const std::string& filepath, TmxMapData& data);
+};
\ No newline at end of file
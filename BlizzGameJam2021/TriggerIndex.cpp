@@ -0,0 +1,183 @@
+#include "TriggerIndex.h"
+#include "CollisionKernel.h"
+#include "Map.h"
+#include "Constants.h"
+#include <algorithm>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Constructor
+
+TriggerIndex::TriggerIndex(MapArena* arena)
+	: triggers(arena), tileTriggerIndices(arena), triggersByTile(ArenaAllocator<std::pair<const int, TileTriggers>>(arena))
+{
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+int TriggerIndex::Add(TriggerType type, int payloadIndex, double x, double y, int width, int height)
+{
+#if _DEBUG
+	assert(type >= 0 && type < NUM_TRIGGER_TYPES);
+	assert(this->triggersByTile.empty());	//add everything before Bake()
+#endif
+
+	Trigger trigger;
+	trigger.type = type;
+	trigger.payloadIndex = payloadIndex;
+	CollisionKernel::GetEdges(x, y, width, height, trigger.left, trigger.top, trigger.right, trigger.bottom);
+
+	this->triggers.push_back(trigger);
+	this->queryStamps.push_back(0);
+
+	return static_cast<int>(this->triggers.size()) - 1;
+}
+
+void TriggerIndex::Bake(int rowCount, int columnCount)
+{
+	this->rowCount = rowCount;
+	this->columnCount = columnCount;
+
+	if (rowCount <= 0 || columnCount <= 0)
+		return;
+
+	//every (tile, trigger) pair, grouped by tile so each tile's triggers end up next to each other
+	std::vector<std::pair<int, int>> tileTriggerPairs;
+	for (int triggerIndex = 0; triggerIndex < this->GetCount(); triggerIndex++)
+	{
+		const Trigger& trigger = this->triggers[triggerIndex];
+
+		int firstRow, firstColumn, lastRow, lastColumn;
+		this->getTiles(trigger.left, trigger.top, trigger.right, trigger.bottom, firstRow, firstColumn, lastRow, lastColumn);
+
+		for (int row = firstRow; row <= lastRow; row++)
+		{
+			for (int column = firstColumn; column <= lastColumn; column++)
+			{
+				tileTriggerPairs.push_back({ (row * columnCount) + column, triggerIndex });
+			}
+		}
+	}
+
+	std::sort(tileTriggerPairs.begin(), tileTriggerPairs.end());
+
+	//sized up front, anything the arena hands out for a rehash would only be freed with the map
+	this->tileTriggerIndices.reserve(tileTriggerPairs.size());
+	this->triggersByTile.reserve(tileTriggerPairs.size());
+	for (const std::pair<int, int>& tileTrigger : tileTriggerPairs)
+	{
+		TileTriggers& tileTriggers = this->triggersByTile.insert({ tileTrigger.first, TileTriggers{ static_cast<int>(this->tileTriggerIndices.size()), 0 } }).first->second;
+		tileTriggers.count++;
+
+		this->tileTriggerIndices.push_back(tileTrigger.second);
+	}
+}
+
+void TriggerIndex::Update(double x, double y, int width, int height, std::vector<TriggerEvent>& events)
+{
+	events.clear();
+
+	this->findOverlapping(x, y, width, height);
+
+	//just arrived, so whatever we're standing in was already there rather than stepped into
+	if (!this->isOccupancyKnown)
+	{
+		this->occupiedTriggers.swap(this->currentTriggers);
+		this->isOccupancyKnown = true;
+		return;
+	}
+
+	//exits first, so leaving one trigger and entering another in the same frame reads in that order
+	for (int triggerIndex : this->occupiedTriggers)
+	{
+		if (!std::binary_search(this->currentTriggers.begin(), this->currentTriggers.end(), triggerIndex))
+			events.push_back({ triggerIndex, false });
+	}
+
+	for (int triggerIndex : this->currentTriggers)
+	{
+		if (!std::binary_search(this->occupiedTriggers.begin(), this->occupiedTriggers.end(), triggerIndex))
+			events.push_back({ triggerIndex, true });
+	}
+
+	this->occupiedTriggers.swap(this->currentTriggers);
+}
+
+void TriggerIndex::ResetOccupancy()
+{
+	//e.g. the player was teleported here, the next Update() only records where they ended up
+	this->occupiedTriggers.clear();
+	this->isOccupancyKnown = false;
+}
+
+const Trigger& TriggerIndex::Get(int triggerIndex) const
+{
+	return this->triggers[triggerIndex];
+}
+
+int TriggerIndex::GetCount() const
+{
+	return static_cast<int>(this->triggers.size());
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+void TriggerIndex::findOverlapping(double x, double y, int width, int height)
+{
+	//every trigger the box is inside of, in trigger order
+	this->currentTriggers.clear();
+
+	if (this->triggersByTile.empty())
+		return;
+
+	int left, top, right, bottom;
+	CollisionKernel::GetEdges(x, y, width, height, left, top, right, bottom);
+
+	int firstRow, firstColumn, lastRow, lastColumn;
+	this->getTiles(left, top, right, bottom, firstRow, firstColumn, lastRow, lastColumn);
+
+	this->queryStamp++;
+
+	for (int row = firstRow; row <= lastRow; row++)
+	{
+		for (int column = firstColumn; column <= lastColumn; column++)
+		{
+			const TileTriggerMap::const_iterator it = this->triggersByTile.find((row * this->columnCount) + column);
+			if (it == this->triggersByTile.end())
+				continue;
+
+			for (int i = it->second.first; i < it->second.first + it->second.count; i++)
+			{
+				const int triggerIndex = this->tileTriggerIndices[i];
+				if (this->queryStamps[triggerIndex] == this->queryStamp)
+					continue;
+
+				this->queryStamps[triggerIndex] = this->queryStamp;
+
+				//sharing a tile isn't enough, e.g. teleporters are only a pixel tall
+				const Trigger& trigger = this->triggers[triggerIndex];
+				if (CollisionKernel::TestEdges(left, top, right, bottom, trigger.left, trigger.top, trigger.right, trigger.bottom))
+					this->currentTriggers.push_back(triggerIndex);
+			}
+		}
+	}
+
+	std::sort(this->currentTriggers.begin(), this->currentTriggers.end());
+}
+
+void TriggerIndex::getTiles(int left, int top, int right, int bottom, int& firstRow, int& firstColumn, int& lastRow, int& lastColumn) const
+{
+	//right and bottom edges are exclusive, a box ending exactly on a tile boundary doesn't reach into the next tile
+	firstColumn = std::max(0, std::min(this->columnCount - 1, Map::GetTileAt(left, TILE_WIDTH)));
+	lastColumn = std::max(0, std::min(this->columnCount - 1, Map::GetTileAt(right - 1, TILE_WIDTH)));
+	firstRow = std::max(0, std::min(this->rowCount - 1, Map::GetTileAt(top, TILE_HEIGHT)));
+	lastRow = std::max(0, std::min(this->rowCount - 1, Map::GetTileAt(bottom - 1, TILE_HEIGHT)));
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "MapArena.h"
+#include <vector>
+#include <unordered_map>
+#include <functional>
+
+//what happens when the player steps into a trigger, payloadIndex says which one of that kind (e.g. index into World's teleporters)
+enum TriggerType
+{
+	TELEPORT = 0,
+
+	NUM_TRIGGER_TYPES
+};
+
+//a box positioned by its centre like Object, touching edges don't count as being inside it
+struct Trigger
+{
+	TriggerType type;
+	int payloadIndex;
+	int left;
+	int top;
+	int right;
+	int bottom;
+};
+
+struct TriggerEvent
+{
+	int triggerIndex;
+	bool isEnter;		//false when the player just stepped out of it
+};
+
+//every trigger on a map, baked into per-tile lists when the map loads so the player's tiles find their candidates straight away
+//triggers only fire on the frame the player enters or leaves them, not every frame they're inside
+class TriggerIndex
+{
+public:
+	TriggerIndex(MapArena* arena);
+
+	int Add(TriggerType type, int payloadIndex, double x, double y, int width, int height);
+	void Bake(int rowCount, int columnCount);
+
+	void Update(double x, double y, int width, int height, std::vector<TriggerEvent>& events);
+	void ResetOccupancy();
+
+	const Trigger& Get(int triggerIndex) const;
+	int GetCount() const;
+
+private:
+	//where a tile's triggers sit in tileTriggerIndices
+	struct TileTriggers
+	{
+		int first;
+		int count;
+	};
+	typedef std::unordered_map<int, TileTriggers, std::hash<int>, std::equal_to<int>, ArenaAllocator<std::pair<const int, TileTriggers>>> TileTriggerMap;
+
+	void findOverlapping(double x, double y, int width, int height);
+	void getTiles(int left, int top, int right, int bottom, int& firstRow, int& firstColumn, int& lastRow, int& lastColumn) const;
+
+	int rowCount = 0;
+	int columnCount = 0;
+
+	ArenaVector<Trigger> triggers;
+	ArenaVector<int> tileTriggerIndices;	//grouped by tile, only tiles with at least one trigger have an entry in triggersByTile
+	TileTriggerMap triggersByTile;
+
+	std::vector<int> occupiedTriggers;		//sorted, what the player was inside as of the last Update()
+	bool isOccupancyKnown = false;			//false until the first Update() after loading or ResetOccupancy(), which only records where the player is
+
+	//scratch for Update()
+	std::vector<int> currentTriggers;
+	std::vector<unsigned int> queryStamps;	//indexed by trigger, a trigger spanning several tiles is only collected once per query
+	unsigned int queryStamp = 0;
+};
\ No newline at end of file
@@ -0,0 +1,234 @@
+#include "World.h"
+#include "Map.h"
+#include "MapBundle.h"
+#include "TmxLoader.h"
+#include "Constants.h"
+#include <cstring>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Constructor
+
+World::World(MapHandle mapHandle, ThreadPool* threadPool)
+	: mapHandle(mapHandle), threadPool(threadPool), arena(MAP_ARENA_BLOCK_SIZE), triggers(&this->arena), entities(&this->arena)
+{
+#if _DEBUG
+	assert(mapHandle != INVALID_MAP_HANDLE);
+	assert(threadPool);
+#endif
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+World::~World()
+{
+	if (this->map)
+	{
+		delete this->map;
+		this->map = nullptr;
+	}
+}
+
+bool World::Load()
+{
+	//file i/o, parsing and image decoding only, nothing here touches the renderer so it can run on any thread
+	const MapDefinition& definition = MapRegistry::Get(this->mapHandle);
+
+	//a Tiled map carries its own tileset, teleporters and spawns, so the one file is all we need
+	if (definition.isTmx)
+	{
+		TmxMapData tmxData;
+		bool loadTmxResult = TmxLoader::Load(definition.mapFilePathsByLayer.at(0), tmxData);
+
+#if _DEBUG
+		assert(loadTmxResult);
+#endif
+
+		if (!loadTmxResult)
+			return false;
+
+		this->map = new Map(tmxData);
+		this->teleporters = std::move(tmxData.teleporters);
+		this->entities.Create(tmxData.spawns);
+		this->bakeTriggers();
+
+		return true;
+	}
+
+	//prefer a compiled bundle if one has been built for this map (and still matches its .csv files), it's a straight memory map with no text parsing
+	MapBundle bundle(definition.bundleFilePath);
+	if (bundle.Open(definition))
+	{
+		this->map = new Map(bundle, definition.tilesetHandle);
+		this->loadBundleTeleporters(bundle);
+		this->loadBundleSpawns(bundle);
+		this->bakeTriggers();
+
+		return true;
+	}
+
+	this->map = new Map(definition.mapFilePathsByLayer, definition.tilesetHandle, this->threadPool);
+
+	//malformed layer files are reported by the loader and leave the map empty
+	if (!this->map->GetIsLoaded())
+		return false;
+
+	bool loadTeleportersResult = this->loadTeleporters(definition.teleportersFilePath);
+
+#if _DEBUG
+	assert(loadTeleportersResult);
+#endif
+
+	if (!loadTeleportersResult)
+		return false;
+
+	bool loadSpawnsResult = this->loadSpawns(definition.spawnsFilePath);
+
+#if _DEBUG
+	assert(loadSpawnsResult);
+#endif
+
+	if (!loadSpawnsResult)
+		return false;
+
+	this->bakeTriggers();
+
+	return true;
+}
+
+bool World::FinishLoading()
+{
+	//render thread only, uploads whatever Load() decoded and bakes the map
+	if (this->isFinished)
+		return true;
+
+	if (!this->map || !this->map->FinishLoading())
+		return false;
+
+	if (!this->entities.UploadTextures())
+		return false;
+
+	this->isFinished = true;
+
+	return true;
+}
+
+void World::ResetEntities()
+{
+	//put everything back where the spawns file had it, from what we already have in memory
+	this->entities.Reset();
+}
+
+size_t World::GetByteCount() const
+{
+	size_t byteCount = this->entities.GetByteCount();
+
+	if (this->map)
+		byteCount += this->map->GetByteCount();
+
+	return byteCount;
+}
+
+const MapArenaStats& World::GetArenaStats() const
+{
+	return this->arena.GetStats();
+}
+
+MapHandle World::GetMapHandle() const
+{
+	return this->mapHandle;
+}
+
+Map* World::GetMap() const
+{
+	return this->map;
+}
+
+std::vector<Teleporter>& World::GetTeleporters()
+{
+	return this->teleporters;
+}
+
+TriggerIndex& World::GetTriggers()
+{
+	return this->triggers;
+}
+
+EntityStore& World::GetEntities()
+{
+	return this->entities;
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+bool World::loadTeleporters(const std::string& filepath)
+{
+	return Teleporter::ReadFile(filepath, this->teleporters);
+}
+
+bool World::loadSpawns(const std::string& filepath)
+{
+	std::vector<SpawnDefinition> definitions;
+	if (!EntityStore::ReadDefinitionsFile(filepath, definitions))
+		return false;
+
+	this->entities.Create(definitions);
+
+	return true;
+}
+
+void World::loadBundleTeleporters(const MapBundle& bundle)
+{
+	const MapBundleHeader* header = bundle.GetHeader();
+	const MapBundleTeleporterRecord* records = bundle.GetTeleporters();
+
+	this->teleporters.reserve(header->teleporterCount);
+	for (int i = 0; i < header->teleporterCount; i++)
+	{
+		const MapBundleTeleporterRecord& record = records[i];
+
+		//bundles store the destination by name since handles depend on manifest order
+		const MapHandle destinationMap = MapRegistry::GetHandle(std::string(record.destinationMapName, strnlen(record.destinationMapName, MAP_BUNDLE_NAME_LENGTH)));
+
+#if _DEBUG
+		assert(destinationMap != INVALID_MAP_HANDLE);
+#endif
+
+		this->teleporters.emplace_back(record.x, record.y, TELEPORTER_WIDTH, TELEPORTER_HEIGHT, destinationMap, record.destinationX, record.destinationY);
+	}
+}
+
+void World::loadBundleSpawns(const MapBundle& bundle)
+{
+	const MapBundleHeader* header = bundle.GetHeader();
+	const MapBundleSpawnRecord* records = bundle.GetSpawns();
+
+	std::vector<SpawnDefinition> definitions;
+	definitions.reserve(header->spawnCount);
+	for (int i = 0; i < header->spawnCount; i++)
+	{
+		const MapBundleSpawnRecord& record = records[i];
+		definitions.push_back({ record.id, record.spawnX, record.spawnY, record.width, record.height, std::string(record.texturePath, strnlen(record.texturePath, MAP_BUNDLE_PATH_LENGTH)), record.spriteSheetOffsetX, record.spriteSheetOffsetY, record.shouldIdleMove != 0, record.isEnemy != 0 });
+	}
+
+	this->entities.Create(definitions);
+}
+
+void World::bakeTriggers()
+{
+	for (size_t i = 0; i < this->teleporters.size(); i++)
+	{
+		const Teleporter& teleporter = this->teleporters[i];
+		this->triggers.Add(TriggerType::TELEPORT, static_cast<int>(i), teleporter.GetX(), teleporter.GetY(), teleporter.GetWidth(), teleporter.GetHeight());
+	}
+
+	this->triggers.Bake(this->map->GetRowCount(), this->map->GetColumnCount());
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "MapRegistry.h"
+#include "Teleporter.h"
+#include "EntityStore.h"
+#include "MapArena.h"
+#include "TriggerIndex.h"
+#include <vector>
+
+#pragma region Forward Declarations
+class Map;
+class MapBundle;
+class ThreadPool;
+#pragma endregion
+
+//one map and everything living on it, built in one go (possibly on a background thread) and then swapped in whole
+class World
+{
+public:
+	World(MapHandle mapHandle, ThreadPool* threadPool);
+	~World();
+
+	bool Load();
+	bool FinishLoading();
+	void ResetEntities();
+
+	size_t GetByteCount() const;
+	const MapArenaStats& GetArenaStats() const;
+
+	MapHandle GetMapHandle() const;
+	Map* GetMap() const;
+	std::vector<Teleporter>& GetTeleporters();
+	TriggerIndex& GetTriggers();
+	EntityStore& GetEntities();
+
+private:
+	bool loadTeleporters(const std::string& filepath);
+	bool loadSpawns(const std::string& filepath);
+	void loadBundleTeleporters(const MapBundle& bundle);
+	void loadBundleSpawns(const MapBundle& bundle);
+	void bakeTriggers();
+
+	MapHandle mapHandle;
+	ThreadPool* threadPool;				//shared by every map load, owned by Game
+	MapArena arena;						//declared before everything allocating from it, so it's the last thing torn down
+	Map* map = nullptr;
+	std::vector<Teleporter> teleporters;
+	TriggerIndex triggers;				//teleporters (and anything else the player can step into), by tile
+	EntityStore entities;
+	bool isFinished = false;
+};
\ No newline at end of file
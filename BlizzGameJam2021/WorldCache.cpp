@@ -0,0 +1,136 @@
+#include "WorldCache.h"
+#include "World.h"
+#include "Map.h"
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Constructor
+
+WorldCache::WorldCache(size_t byteBudget)
+	: byteBudget(byteBudget)
+{
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+WorldCache::~WorldCache()
+{
+	this->Clear();
+}
+
+void WorldCache::Put(World* world)
+{
+#if _DEBUG
+	assert(world);
+#endif
+
+	if (!world)
+		return;
+
+	//a map reloaded while we were on it replaces whatever we had cached for it
+	delete this->Take(world->GetMapHandle());
+
+	const size_t worldByteCount = world->GetByteCount();
+
+	//no point evicting everything else for something that can never fit
+	if (worldByteCount > this->byteBudget)
+	{
+		delete world;
+		return;
+	}
+
+	this->cachedWorlds.push_front({ world, worldByteCount });
+	this->byteCount += worldByteCount;
+
+	this->evictWorlds();
+}
+
+World* WorldCache::Take(MapHandle mapHandle)
+{
+	for (std::list<CachedWorld>::iterator it = this->cachedWorlds.begin(); it != this->cachedWorlds.end(); ++it)
+	{
+		if (it->world->GetMapHandle() != mapHandle)
+			continue;
+
+		World* world = it->world;
+		this->byteCount -= it->byteCount;
+		this->cachedWorlds.erase(it);
+
+		return world;
+	}
+
+	return nullptr;
+}
+
+bool WorldCache::Contains(MapHandle mapHandle) const
+{
+	for (const CachedWorld& cachedWorld : this->cachedWorlds)
+	{
+		if (cachedWorld.world->GetMapHandle() == mapHandle)
+			return true;
+	}
+
+	return false;
+}
+
+void WorldCache::Clear()
+{
+	for (const CachedWorld& cachedWorld : this->cachedWorlds)
+	{
+		delete cachedWorld.world;
+	}
+	this->cachedWorlds.clear();
+	this->byteCount = 0;
+}
+
+void WorldCache::RebakeAll()
+{
+	//render targets of cached maps are lost on a device reset just like the active one's
+	for (const CachedWorld& cachedWorld : this->cachedWorlds)
+	{
+		cachedWorld.world->GetMap()->RebakeChunks();
+	}
+}
+
+size_t WorldCache::GetByteBudget() const
+{
+	return this->byteBudget;
+}
+
+void WorldCache::SetByteBudget(size_t byteBudget)
+{
+	this->byteBudget = byteBudget;
+	this->evictWorlds();
+}
+
+size_t WorldCache::GetByteCount() const
+{
+	return this->byteCount;
+}
+
+int WorldCache::GetWorldCount() const
+{
+	return static_cast<int>(this->cachedWorlds.size());
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+void WorldCache::evictWorlds()
+{
+	//least recently left go first
+	while (this->byteCount > this->byteBudget && !this->cachedWorlds.empty())
+	{
+		const CachedWorld& oldest = this->cachedWorlds.back();
+		this->byteCount -= oldest.byteCount;
+		delete oldest.world;
+		this->cachedWorlds.pop_back();
+	}
+}
+
+#pragma endregion
\ No newline at end of file
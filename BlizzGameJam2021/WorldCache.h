@@ -0,0 +1,41 @@
+#pragma once
+
+#include "MapRegistry.h"
+#include <list>
+
+#pragma region Forward Declarations
+class World;
+#pragma endregion
+
+//maps we've recently left, kept whole (tiles, textures, spawns) so walking back into one doesn't touch the disk
+class WorldCache
+{
+public:
+	WorldCache(size_t byteBudget);
+	~WorldCache();
+
+	void Put(World* world);
+	World* Take(MapHandle mapHandle);
+	bool Contains(MapHandle mapHandle) const;
+	void Clear();
+
+	void RebakeAll();
+
+	size_t GetByteBudget() const;
+	void SetByteBudget(size_t byteBudget);
+	size_t GetByteCount() const;
+	int GetWorldCount() const;
+
+private:
+	struct CachedWorld
+	{
+		World* world;
+		size_t byteCount;	//measured when it went in, cached worlds don't change
+	};
+
+	void evictWorlds();
+
+	size_t byteBudget;
+	size_t byteCount = 0;
+	std::list<CachedWorld> cachedWorlds;	//most recently left first
+};
\ No newline at end of file
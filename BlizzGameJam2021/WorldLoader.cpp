@@ -0,0 +1,150 @@
+#include "WorldLoader.h"
+#include "World.h"
+#include <algorithm>
+
+#if _DEBUG
+	#include <assert.h>
+#endif
+
+#pragma region Constructor
+
+WorldLoader::WorldLoader(ThreadPool* threadPool)
+	: threadPool(threadPool)
+{
+	this->worker = std::thread(&WorldLoader::workerLoop, this);
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+WorldLoader::~WorldLoader()
+{
+	//a load already in progress still runs to the end, everything queued behind it is dropped
+	{
+		std::lock_guard<std::mutex> lock(this->queueMutex);
+		this->stopRequested = true;
+		this->requestQueue.clear();
+	}
+	this->queueCondition.notify_all();
+
+	if (this->worker.joinable())
+		this->worker.join();
+
+	for (const std::pair<const MapHandle, World*>& completed : this->completedWorlds)
+	{
+		delete completed.second;
+	}
+	this->completedWorlds.clear();
+}
+
+void WorldLoader::Request(MapHandle mapHandle)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->queueMutex);
+
+		//already built, being built or waiting to be
+		if (this->completedWorlds.count(mapHandle) || this->loadingMapHandle == mapHandle || std::find(this->requestQueue.begin(), this->requestQueue.end(), mapHandle) != this->requestQueue.end())
+			return;
+
+		this->requestQueue.push_back(mapHandle);
+	}
+	this->queueCondition.notify_one();
+}
+
+void WorldLoader::Retain(const std::vector<MapHandle>& mapHandles)
+{
+	//drops every queued or finished world that isn't listed, one still being built is kept until the next call
+	std::vector<World*> releasedWorlds;
+
+	{
+		std::lock_guard<std::mutex> lock(this->queueMutex);
+
+		const auto isRetained = [&mapHandles](MapHandle mapHandle) { return std::find(mapHandles.begin(), mapHandles.end(), mapHandle) != mapHandles.end(); };
+
+		this->requestQueue.erase(std::remove_if(this->requestQueue.begin(), this->requestQueue.end(), [&isRetained](MapHandle mapHandle) { return !isRetained(mapHandle); }), this->requestQueue.end());
+
+		for (std::map<MapHandle, World*>::iterator it = this->completedWorlds.begin(); it != this->completedWorlds.end();)
+		{
+			if (isRetained(it->first))
+			{
+				++it;
+				continue;
+			}
+
+			releasedWorlds.push_back(it->second);
+			it = this->completedWorlds.erase(it);
+		}
+	}
+
+	//freeing a world can take a moment, no need to hold up the worker for it
+	for (World* world : releasedWorlds)
+	{
+		delete world;
+	}
+}
+
+World* WorldLoader::Take(MapHandle mapHandle)
+{
+	std::unique_lock<std::mutex> lock(this->queueMutex);
+
+	//never requested (or still queued behind other loads), the caller is better off loading it right away
+	std::deque<MapHandle>::iterator queued = std::find(this->requestQueue.begin(), this->requestQueue.end(), mapHandle);
+	if (queued != this->requestQueue.end())
+	{
+		this->requestQueue.erase(queued);
+		return nullptr;
+	}
+
+	//the worker is on it, wait for it to finish rather than loading it twice
+	this->completedCondition.wait(lock, [this, mapHandle]() { return this->loadingMapHandle != mapHandle; });
+
+	std::map<MapHandle, World*>::iterator completed = this->completedWorlds.find(mapHandle);
+	if (completed == this->completedWorlds.end())
+		return nullptr;
+
+	World* world = completed->second;
+	this->completedWorlds.erase(completed);
+
+	return world;
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+void WorldLoader::workerLoop()
+{
+	while (true)
+	{
+		MapHandle mapHandle = INVALID_MAP_HANDLE;
+
+		{
+			std::unique_lock<std::mutex> lock(this->queueMutex);
+			this->queueCondition.wait(lock, [this]() { return this->stopRequested || !this->requestQueue.empty(); });
+
+			if (this->stopRequested)
+				return;
+
+			mapHandle = this->requestQueue.front();
+			this->requestQueue.pop_front();
+			this->loadingMapHandle = mapHandle;
+		}
+
+		World* world = new World(mapHandle, this->threadPool);
+		if (!world->Load())
+		{
+			delete world;
+			world = nullptr;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(this->queueMutex);
+			this->completedWorlds[mapHandle] = world;
+			this->loadingMapHandle = INVALID_MAP_HANDLE;
+		}
+		this->completedCondition.notify_all();
+	}
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "MapRegistry.h"
+#include <vector>
+#include <deque>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#pragma region Forward Declarations
+class World;
+class ThreadPool;
+#pragma endregion
+
+//builds worlds on a background thread ahead of time, so switching to one is just taking the finished World
+class WorldLoader
+{
+public:
+	WorldLoader(ThreadPool* threadPool);
+	~WorldLoader();
+
+	void Request(MapHandle mapHandle);
+	void Retain(const std::vector<MapHandle>& mapHandles);
+	World* Take(MapHandle mapHandle);
+
+private:
+	void workerLoop();
+
+	ThreadPool* threadPool;		//handed to every World we build
+
+	//shared with the worker thread, guarded by queueMutex
+	std::mutex queueMutex;
+	std::condition_variable queueCondition;			//signalled when a load is requested or we're stopping
+	std::condition_variable completedCondition;		//signalled whenever the worker finishes a load
+	std::deque<MapHandle> requestQueue;
+	MapHandle loadingMapHandle = INVALID_MAP_HANDLE;	//what the worker is building right now
+	std::map<MapHandle, World*> completedWorlds;		//nullptr if the load failed
+	bool stopRequested = false;
+
+	std::thread worker;
+};
\ No newline at end of file
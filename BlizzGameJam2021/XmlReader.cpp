@@ -0,0 +1,219 @@
+#include "XmlReader.h"
+#include <fstream>
+#include <sstream>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+#pragma region Constructor
+
+XmlReader::XmlReader(const std::string& text)
+	: text(text), position(0)
+{
+}
+
+#pragma endregion
+
+#pragma region Public Methods
+
+XmlReader::~XmlReader()
+{
+
+}
+
+bool XmlReader::ReadFile(const std::string& filepath, std::string& text)
+{
+	std::ifstream file(filepath.c_str(), std::ios::in | std::ios::binary);
+
+	if (!file.is_open())
+		return false;
+
+	std::ostringstream contents;
+	contents << file.rdbuf();
+	text = contents.str();
+
+	return true;
+}
+
+std::string XmlReader::GetDirectory(const std::string& filepath)
+{
+	//paths inside Tiled files are relative to the file that references them
+	const size_t separator = filepath.find_last_of("/\\");
+	return separator == std::string::npos ? "" : filepath.substr(0, separator + 1);
+}
+
+bool XmlReader::NextTag(XmlTag& tag)
+{
+	//skip comments and declarations
+	size_t start;
+	while (true)
+	{
+		start = this->text.find('<', this->position);
+		if (start == std::string::npos || start + 1 >= this->text.size())
+			return false;
+
+		if (this->text.compare(start, 4, "<!--") == 0)
+		{
+			const size_t end = this->text.find("-->", start + 4);
+			if (end == std::string::npos)
+				return false;
+
+			this->position = end + 3;
+			continue;
+		}
+
+		if (this->text[start + 1] == '?' || this->text[start + 1] == '!')
+		{
+			const size_t end = this->text.find('>', start);
+			if (end == std::string::npos)
+				return false;
+
+			this->position = end + 1;
+			continue;
+		}
+
+		break;
+	}
+
+	tag.name.clear();
+	tag.attributes.clear();
+	tag.isClosing = false;
+	tag.isSelfClosing = false;
+
+	size_t i = start + 1;
+	if (this->text[i] == '/')
+	{
+		tag.isClosing = true;
+		i++;
+	}
+
+	const size_t nameStart = i;
+	while (i < this->text.size() && !isspace(static_cast<unsigned char>(this->text[i])) && this->text[i] != '>' && this->text[i] != '/')
+		i++;
+	tag.name = this->text.substr(nameStart, i - nameStart);
+
+	while (i < this->text.size())
+	{
+		if (isspace(static_cast<unsigned char>(this->text[i])))
+		{
+			i++;
+			continue;
+		}
+
+		if (this->text[i] == '/')
+		{
+			tag.isSelfClosing = true;
+			i++;
+			continue;
+		}
+
+		//leave position just past the '>' so text content can be read from there
+		if (this->text[i] == '>')
+		{
+			this->position = i + 1;
+			return true;
+		}
+
+		//name="value" (or name='value')
+		const size_t attributeNameStart = i;
+		while (i < this->text.size() && this->text[i] != '=' && !isspace(static_cast<unsigned char>(this->text[i])) && this->text[i] != '>')
+			i++;
+		const std::string attributeName = this->text.substr(attributeNameStart, i - attributeNameStart);
+
+		while (i < this->text.size() && isspace(static_cast<unsigned char>(this->text[i])))
+			i++;
+
+		if (i >= this->text.size() || this->text[i] != '=')
+			return false;
+		i++;
+
+		while (i < this->text.size() && isspace(static_cast<unsigned char>(this->text[i])))
+			i++;
+
+		if (i >= this->text.size() || (this->text[i] != '"' && this->text[i] != '\''))
+			return false;
+
+		const char quote = this->text[i];
+		const size_t valueEnd = this->text.find(quote, i + 1);
+		if (valueEnd == std::string::npos)
+			return false;
+
+		tag.attributes[attributeName] = XmlReader::unescape(this->text.substr(i + 1, valueEnd - i - 1));
+		i = valueEnd + 1;
+	}
+
+	return false;
+}
+
+const std::string& XmlReader::GetText() const
+{
+	return this->text;
+}
+
+size_t XmlReader::GetPosition() const
+{
+	return this->position;
+}
+
+void XmlReader::SetPosition(size_t position)
+{
+	this->position = position;
+}
+
+std::string XmlTag::GetAttribute(const char* attributeName, const std::string& defaultValue /*= ""*/) const
+{
+	const std::map<std::string, std::string>::const_iterator it = this->attributes.find(attributeName);
+	return it == this->attributes.end() ? defaultValue : it->second;
+}
+
+int XmlTag::GetIntAttribute(const char* attributeName, int defaultValue /*= 0*/) const
+{
+	const std::map<std::string, std::string>::const_iterator it = this->attributes.find(attributeName);
+	return it == this->attributes.end() ? defaultValue : atoi(it->second.c_str());
+}
+
+double XmlTag::GetDoubleAttribute(const char* attributeName, double defaultValue /*= 0.0*/) const
+{
+	const std::map<std::string, std::string>::const_iterator it = this->attributes.find(attributeName);
+	return it == this->attributes.end() ? defaultValue : atof(it->second.c_str());
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+
+std::string XmlReader::unescape(const std::string& value)
+{
+	if (value.find('&') == std::string::npos)
+		return value;
+
+	static const std::pair<const char*, char> entities[] = { { "&amp;", '&' }, { "&lt;", '<' }, { "&gt;", '>' }, { "&quot;", '"' }, { "&apos;", '\'' } };
+
+	std::string result;
+	result.reserve(value.size());
+	for (size_t i = 0; i < value.size(); i++)
+	{
+		bool replaced = false;
+		if (value[i] == '&')
+		{
+			for (const std::pair<const char*, char>& entity : entities)
+			{
+				const size_t entityLength = strlen(entity.first);
+				if (value.compare(i, entityLength, entity.first) == 0)
+				{
+					result.push_back(entity.second);
+					i += entityLength - 1;
+					replaced = true;
+					break;
+				}
+			}
+		}
+
+		if (!replaced)
+			result.push_back(value[i]);
+	}
+
+	return result;
+}
+
+#pragma endregion
\ No newline at end of file
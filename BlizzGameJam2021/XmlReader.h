@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <map>
+
+//just enough xml for the files Tiled writes (.tmx, .tsx): tags, attributes and text content, no namespaces or CDATA
+struct XmlTag
+{
+	std::string name;
+	std::map<std::string, std::string> attributes;
+	bool isClosing = false;
+	bool isSelfClosing = false;
+
+	std::string GetAttribute(const char* attributeName, const std::string& defaultValue = "") const;
+	int GetIntAttribute(const char* attributeName, int defaultValue = 0) const;
+	double GetDoubleAttribute(const char* attributeName, double defaultValue = 0.0) const;
+};
+
+class XmlReader
+{
+public:
+	XmlReader(const std::string& text);
+	~XmlReader();
+
+	static bool ReadFile(const std::string& filepath, std::string& text);
+	static std::string GetDirectory(const std::string& filepath);
+
+	bool NextTag(XmlTag& tag);
+
+	const std::string& GetText() const;
+	size_t GetPosition() const;
+	void SetPosition(size_t position);
+
+private:
+	static std::string unescape(const std::string& value);
+
+	const std::string& text;
+	size_t position;
+};
\ No newline at end of file
@@ -1,22 +1,101 @@
 #include "Display.h"
 #include "Audio.h"
 #include "Game.h"
+#include "MapBundle.h"
+#include "TilesetRegistry.h"
+#include "TextureCache.h"
+#include "MapRegistry.h"
+#include "CollisionKernel.h"
+#include "ThreadPool.h"
+#include "Constants.h"
+#include <cstring>
+#include <chrono>
+
+//runs the given number of ticks back to back, as fast as they'll go, and reports how long loading and simulating took
+static void runHeadless(Game* game, int tickCount, std::chrono::steady_clock::duration loadTime)
+{
+	const std::chrono::steady_clock::time_point simulationStartTime = std::chrono::steady_clock::now();
+
+	for (int tick = 0; tick < tickCount; tick++)
+	{
+		game->InjectTick();
+		Display::InjectFrame();
+	}
+
+	const std::chrono::steady_clock::duration simulationTime = std::chrono::steady_clock::now() - simulationStartTime;
+
+	const double loadTimeInMilliseconds = std::chrono::duration<double, std::milli>(loadTime).count();
+	const double simulationTimeInMilliseconds = std::chrono::duration<double, std::milli>(simulationTime).count();
+	const DisplayStats& stats = Display::GetStats();
+
+	printf("Loaded %s in %.2f ms\n", STARTING_MAP_NAME, loadTimeInMilliseconds);
+	printf("Simulated %d ticks (%.2f s of game time) in %.2f ms, %.0f ticks per second\n", tickCount, (tickCount * SIMULATION_TICK_TIME) / 1000.0, simulationTimeInMilliseconds, tickCount / (simulationTimeInMilliseconds / 1000.0));
+	printf("Submitted per frame: %.1f textures, %.1f tiles, %.1f rectangles, %.1f texts\n", stats.textures / static_cast<double>(stats.frames), stats.tiles / static_cast<double>(stats.frames), stats.rectangles / static_cast<double>(stats.frames), stats.texts / static_cast<double>(stats.frames));
+	printf("Collision kernel: %s\n", CollisionKernel::GetInstructionSetName(CollisionKernel::GetInstructionSet()));
+}
 
 int main(int argc, char* args[])
 {
-	if (!Display::Initialize())
+	//every map is interned from the manifest up front, the rest of the game refers to them by handle
+	if (!MapRegistry::Initialize(MAPS_MANIFEST_FILEPATH))
 	{
 		return -1;
 	}
 
-	if (!Audio::Initialize())
+	//offline map compiler, builds the bundle Game::SwitchMap prefers over a map's .csv files:
+	//BlizzGameJam2021 --compile-map <map name from the manifest> [output.bgjmap]
+	if (argc >= 3 && strcmp(args[1], "--compile-map") == 0)
+	{
+		MapHandle mapHandle = MapRegistry::GetHandle(args[2]);
+		if (mapHandle == INVALID_MAP_HANDLE)
+		{
+			printf("Unknown map %s\n", args[2]);
+			return -1;
+		}
+
+		const MapDefinition& definition = MapRegistry::Get(mapHandle);
+		std::string outputFilePath = (argc >= 4) ? args[3] : definition.bundleFilePath;
+
+		ThreadPool threadPool(ThreadPool::GetDefaultThreadCount());
+		if (!MapBundle::Compile(definition, outputFilePath, &threadPool))
+		{
+			return -1;
+		}
+
+		printf("Wrote %s\n", outputFilePath.c_str());
+		return 0;
+	}
+
+	//no window, renderer or audio device, e.g. to measure load and simulation throughput on a server:
+	//BlizzGameJam2021 --headless <ticks>
+	int headlessTickCount = 0;
+	if (argc >= 3 && strcmp(args[1], "--headless") == 0)
+	{
+		headlessTickCount = atoi(args[2]);
+		if (headlessTickCount <= 0)
+		{
+			printf("Invalid tick count %s\n", args[2]);
+			return -1;
+		}
+	}
+	const bool isHeadless = headlessTickCount > 0;
+
+	if (!Display::Initialize(isHeadless))
+	{
+		return -1;
+	}
+
+	if (!Audio::Initialize(isHeadless))
 	{
 		return -1;
 	}
 
+	const std::chrono::steady_clock::time_point loadStartTime = std::chrono::steady_clock::now();
 	Game* game = new Game();
+	const std::chrono::steady_clock::duration loadTime = std::chrono::steady_clock::now() - loadStartTime;
 
-	bool keepRunning = true;
+	//headless runs its ticks below instead of the game loop
+	bool keepRunning = !isHeadless;
 
 	Display::SetEventCallback([&keepRunning, &game](SDL_Event e)
 	{
@@ -63,6 +142,12 @@ int main(int argc, char* args[])
 				game->InjectKeyUp(32);
 				break;
 			}
+			case SDL_RENDER_TARGETS_RESET:
+			{
+				//baked map chunks live in render targets, which the driver just threw away
+				game->InjectRenderTargetsReset();
+				break;
+			}
 			case SDL_QUIT:
 			{
 				keepRunning = false;
@@ -71,6 +156,11 @@ int main(int argc, char* args[])
 		}
 	});
 
+	if (isHeadless)
+	{
+		runHeadless(game, headlessTickCount, loadTime);
+	}
+
 	//game loop
 	while (keepRunning)
 	{
@@ -83,6 +173,14 @@ int main(int argc, char* args[])
 
 	delete game;
 
+	MapRegistry::ShutDown();
+
+	//tilesets stay loaded across map switches, free them once we're done with every map
+	TilesetRegistry::ShutDown();
+
+	//after everything that holds textures is gone, but while there's still a renderer to free them with
+	TextureCache::ShutDown();
+
 	if (!Audio::ShutDown())
 	{
 		return -1;
@@ -0,0 +1,123 @@
+#include "CollisionKernel.h"
+#include <climits>
+#include <cstdio>
+#include <random>
+
+//checks every SIMD path the cpu supports gives the same hit masks as CollisionKernel::TestOneScalar()
+
+static int failureCount = 0;
+
+static void compareWithScalar(CollisionInstructionSet instructionSet, int left, int top, int right, int bottom, const PackedBoxes& boxes, int first, int count, const char* caseName)
+{
+	std::vector<unsigned int> expectedHitMask;
+	std::vector<unsigned int> hitMask;
+
+	CollisionKernel::TestOneScalar(left, top, right, bottom, boxes, first, count, expectedHitMask);
+	CollisionKernel::SetInstructionSet(instructionSet);
+	CollisionKernel::TestOne(left, top, right, bottom, boxes, first, count, hitMask);
+
+	for (int i = 0; i < count; i++)
+	{
+		if (CollisionKernel::GetHit(hitMask, i) == CollisionKernel::GetHit(expectedHitMask, i))
+			continue;
+
+		printf("%s: %s box %d of %d (first %d) is %s, expected %s\n", CollisionKernel::GetInstructionSetName(instructionSet), caseName, i, count, first, CollisionKernel::GetHit(hitMask, i) ? "hit" : "missed", CollisionKernel::GetHit(expectedHitMask, i) ? "hit" : "missed");
+		failureCount++;
+		return;
+	}
+}
+
+static void testEdgeCases(CollisionInstructionSet instructionSet)
+{
+	//a 16x16 box at (0, 0) against boxes touching, overlapping by one pixel and sharing each of its edges
+	PackedBoxes boxes;
+	boxes.AddEdges(16, 0, 32, 16);			//touching the right edge
+	boxes.AddEdges(-16, 0, 0, 16);			//touching the left edge
+	boxes.AddEdges(0, 16, 16, 32);			//touching the bottom edge
+	boxes.AddEdges(0, -16, 16, 0);			//touching the top edge
+	boxes.AddEdges(15, 0, 31, 16);			//one pixel into the right edge
+	boxes.AddEdges(-15, 0, 1, 16);			//one pixel into the left edge
+	boxes.AddEdges(0, 15, 16, 31);			//one pixel into the bottom edge
+	boxes.AddEdges(0, -15, 16, 1);			//one pixel into the top edge
+	boxes.AddEdges(0, 0, 16, 16);			//the same box
+	boxes.AddEdges(4, 4, 12, 12);			//inside it
+	boxes.AddEdges(-4, -4, 20, 20);			//around it
+	boxes.AddEdges(8, 8, 8, 8);				//empty, inside it
+	boxes.AddEdges(16, 16, 32, 32);			//touching a corner
+	boxes.AddEdges(INT_MIN, INT_MIN, INT_MAX, INT_MAX);	//everything
+	boxes.AddEdges(INT_MIN, INT_MIN, 0, 0);	//touching the top left corner from far away
+	boxes.AddEdges(16, 16, INT_MAX, INT_MAX);	//touching the bottom right corner from far away
+	boxes.AddEdges(-100, -100, -50, -50);	//nowhere near
+
+	//every start and length so each one lands in the vectors and in the leftover loop
+	for (int first = 0; first < boxes.GetCount(); first++)
+	{
+		for (int count = 0; first + count <= boxes.GetCount(); count++)
+		{
+			compareWithScalar(instructionSet, 0, 0, 16, 16, boxes, first, count, "edge case");
+		}
+	}
+}
+
+static void testRandomBoxes(CollisionInstructionSet instructionSet)
+{
+	//small coordinates so plenty of them overlap and touch, a few huge ones for the signed compares
+	std::mt19937 random(2021);
+	std::uniform_int_distribution<int> position(-64, 64);
+	std::uniform_int_distribution<int> size(0, 32);
+	std::uniform_int_distribution<int> anywhere(INT_MIN / 2, INT_MAX / 2);
+
+	PackedBoxes boxes;
+	for (int i = 0; i < 1000; i++)
+	{
+		int x = position(random);
+		int y = position(random);
+		if (i % 50 == 0)
+		{
+			x = anywhere(random);
+			y = anywhere(random);
+		}
+
+		boxes.AddEdges(x, y, x + size(random), y + size(random));
+	}
+
+	for (int test = 0; test < 1000; test++)
+	{
+		const int left = position(random);
+		const int top = position(random);
+		const int first = test % 40;
+		const int count = (test * 7) % (boxes.GetCount() - first + 1);
+
+		compareWithScalar(instructionSet, left, top, left + size(random), top + size(random), boxes, first, count, "random");
+	}
+}
+
+int main()
+{
+	const CollisionInstructionSet defaultInstructionSet = CollisionKernel::GetInstructionSet();
+	printf("Default collision kernel: %s\n", CollisionKernel::GetInstructionSetName(defaultInstructionSet));
+
+	for (int instructionSet = COLLISION_INSTRUCTION_SET_SCALAR; instructionSet < NUM_COLLISION_INSTRUCTION_SETS; instructionSet++)
+	{
+		const CollisionInstructionSet set = static_cast<CollisionInstructionSet>(instructionSet);
+		if (!CollisionKernel::IsInstructionSetSupported(set))
+		{
+			printf("Skipped %s, not supported by this cpu or build\n", CollisionKernel::GetInstructionSetName(set));
+			continue;
+		}
+
+		testEdgeCases(set);
+		testRandomBoxes(set);
+		printf("Tested %s\n", CollisionKernel::GetInstructionSetName(set));
+	}
+
+	CollisionKernel::SetInstructionSet(defaultInstructionSet);
+
+	if (failureCount > 0)
+	{
+		printf("%d failures\n", failureCount);
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,242 @@
+#include "EntityStore.h"
+#include "World.h"
+#include "Map.h"
+#include "MapRegistry.h"
+#include "Display.h"
+#include "ThreadPool.h"
+#include "Constants.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+//enemies spawned at runtime have to reuse dead enemies' slots instead of growing the arrays, and a map's arena has to grab memory a block at a time
+//rather than once per entity or tile, run from BlizzGameJam2021/ like the game
+
+#define TEST_TEXTURE_FILEPATH	"../resources/monsters.png"
+
+static int failureCount = 0;
+
+static void expect(bool condition, const std::string& description)
+{
+	if (condition)
+		return;
+
+	printf("%s\n", description.c_str());
+	failureCount++;
+}
+
+static SpawnDefinition getTestDefinition(int id, bool shouldIdleMove, bool isEnemy)
+{
+	return { id, 100.0 + ((id % 50) * 40), 100.0 + ((id / 50) * 40), 32, 32, TEST_TEXTURE_FILEPATH, 192, 224, shouldIdleMove, isEnemy };
+}
+
+//one of each behaviour, like a small map's spawns file
+static std::vector<SpawnDefinition> getTestDefinitions(int count)
+{
+	std::vector<SpawnDefinition> definitions;
+	for (int i = 0; i < count; i++)
+	{
+		definitions.push_back(getTestDefinition(i, i % 3 == 1, i % 3 == 2));
+	}
+
+	return definitions;
+}
+
+static bool haveSameAllocations(const MapArenaStats& a, const MapArenaStats& b)
+{
+	return a.blockAllocations == b.blockAllocations && a.allocations == b.allocations && a.bytesReserved == b.bytesReserved;
+}
+
+static void testEnemySlotReuse()
+{
+	MapArena arena(MAP_ARENA_BLOCK_SIZE);
+	EntityStore entities(&arena);
+
+	const std::vector<SpawnDefinition> definitions = getTestDefinitions(6);
+	entities.Create(definitions);
+
+	const int definitionCount = static_cast<int>(definitions.size());
+	const MapArenaStats statsAfterCreate = arena.GetStats();
+
+	//everything Create() reserved room for goes on the end, in order, without touching the arena
+	for (int i = 0; i < ENTITY_RUNTIME_ENEMY_CAPACITY; i++)
+	{
+		const int index = entities.SpawnEnemy(getTestDefinition(1000 + i, false, true));
+		if (index != definitionCount + i)
+		{
+			expect(false, "Runtime enemy " + std::to_string(i) + " went in slot " + std::to_string(index) + " instead of " + std::to_string(definitionCount + i));
+			return;
+		}
+	}
+
+	const int fullCount = definitionCount + ENTITY_RUNTIME_ENEMY_CAPACITY;
+	expect(entities.GetCount() == fullCount, "Spawning up to the reserved capacity left " + std::to_string(entities.GetCount()) + " entities instead of " + std::to_string(fullCount));
+	expect(haveSameAllocations(arena.GetStats(), statsAfterCreate), "Spawning up to the reserved capacity grew the arena");
+
+	//the last slot freed is the first one reused
+	const int killedSlots[] = { definitionCount + 5, definitionCount + 2, definitionCount + 9 };
+	for (int index : killedSlots)
+	{
+		entities.Kill(index);
+	}
+
+	expect(entities.GetFreeEnemySlotCount() == 3, "Killing 3 runtime enemies left " + std::to_string(entities.GetFreeEnemySlotCount()) + " free slots");
+
+	for (int i = 2; i >= 0; i--)
+	{
+		const int index = entities.SpawnEnemy(getTestDefinition(2000 + i, false, true));
+		expect(index == killedSlots[i], "A respawned enemy went in slot " + std::to_string(index) + " instead of " + std::to_string(killedSlots[i]));
+		expect(entities.GetIsAlive(index) && entities.GetID(index) == 2000 + i && entities.GetHP(index) == ENEMY_HP, "A respawned enemy didn't take over its slot");
+	}
+
+	//kill and respawn every runtime enemy many times over, nothing should grow
+	for (int cycle = 0; cycle < 100; cycle++)
+	{
+		for (int index = definitionCount; index < fullCount; index++)
+		{
+			entities.Kill(index);
+		}
+
+		for (int i = 0; i < ENTITY_RUNTIME_ENEMY_CAPACITY; i++)
+		{
+			entities.SpawnEnemy(getTestDefinition(3000 + i, false, true));
+		}
+	}
+
+	expect(entities.GetCount() == fullCount, "Respawning runtime enemies changed the entity count to " + std::to_string(entities.GetCount()));
+	expect(entities.GetFreeEnemySlotCount() == 0, "Respawning runtime enemies left free slots behind");
+	expect(haveSameAllocations(arena.GetStats(), statsAfterCreate), "Respawning runtime enemies grew the arena");
+
+	//spawns file entities wait for Reset() rather than freeing their slot
+	entities.Kill(0);
+	expect(entities.GetFreeEnemySlotCount() == 0, "Killing a spawns file entity freed its slot");
+
+	//Reset() frees every runtime slot and hands them out lowest first
+	entities.Reset();
+	expect(entities.GetIsAlive(0), "Reset() didn't bring the spawns file entity back");
+	expect(entities.GetFreeEnemySlotCount() == ENTITY_RUNTIME_ENEMY_CAPACITY, "Reset() left " + std::to_string(entities.GetFreeEnemySlotCount()) + " free slots instead of " + std::to_string(ENTITY_RUNTIME_ENEMY_CAPACITY));
+
+	for (int index = definitionCount; index < fullCount; index++)
+	{
+		expect(!entities.GetIsAlive(index), "Reset() left runtime enemy " + std::to_string(index) + " alive");
+	}
+
+	for (int i = 0; i < ENTITY_RUNTIME_ENEMY_CAPACITY; i++)
+	{
+		const int index = entities.SpawnEnemy(getTestDefinition(4000 + i, false, true));
+		if (index != definitionCount + i)
+		{
+			expect(false, "After Reset() runtime enemy " + std::to_string(i) + " went in slot " + std::to_string(index) + " instead of " + std::to_string(definitionCount + i));
+			break;
+		}
+	}
+
+	expect(entities.GetCount() == fullCount, "Spawning after Reset() changed the entity count to " + std::to_string(entities.GetCount()));
+	expect(haveSameAllocations(arena.GetStats(), statsAfterCreate), "Spawning after Reset() grew the arena");
+}
+
+static void testStoreArenaBlocks()
+{
+	//every array is reserved once, so the arena sees the same number of allocations whatever the entity count and never needs more blocks than that
+	int expectedAllocations = -1;
+	for (int count : { 10, 1000, 20000, 100000 })
+	{
+		MapArena arena(MAP_ARENA_BLOCK_SIZE);
+		EntityStore entities(&arena);
+		entities.Create(getTestDefinitions(count));
+
+		const MapArenaStats& stats = arena.GetStats();
+		if (expectedAllocations == -1)
+			expectedAllocations = stats.allocations;
+
+		const std::string description = std::to_string(count) + " entities took " + std::to_string(stats.allocations) + " allocations in " + std::to_string(stats.blockAllocations) + " blocks";
+		expect(static_cast<int>(stats.allocations) == expectedAllocations, description + ", expected " + std::to_string(expectedAllocations) + " allocations");
+		expect(stats.blockAllocations <= stats.allocations, description + ", more blocks than allocations");
+	}
+}
+
+static void testWorldArena(MapHandle mapHandle, ThreadPool* threadPool)
+{
+	const std::string mapName = MapRegistry::Get(mapHandle).name;
+
+	//a map loads into its own arena and frees it in one go, so loading it again has to cost exactly the same
+	MapArenaStats firstLoadStats = {};
+	for (int load = 0; load < 2; load++)
+	{
+		World* world = new World(mapHandle, threadPool);
+		if (!world->Load())
+		{
+			expect(false, "Couldn't load " + mapName);
+			delete world;
+			return;
+		}
+
+		const MapArenaStats stats = world->GetArenaStats();
+		const int tileCount = world->GetMap()->GetRowCount() * world->GetMap()->GetColumnCount() * world->GetMap()->GetNumberOfLayers();
+		const int entityCount = world->GetEntities().GetCount();
+
+		expect(stats.blockAllocations >= 1 && stats.blockAllocations <= (stats.bytesUsed / MAP_ARENA_BLOCK_SIZE) + 1, mapName + " took " + std::to_string(stats.blockAllocations) + " blocks for " + std::to_string(stats.bytesUsed) + " bytes");
+		expect(static_cast<int>(stats.blockAllocations) < tileCount && stats.blockAllocations <= stats.allocations, mapName + " took a block per tile or per allocation");
+
+		if (load == 0)
+			firstLoadStats = stats;
+		else
+			expect(haveSameAllocations(stats, firstLoadStats), "Loading " + mapName + " a second time cost " + std::to_string(stats.blockAllocations) + " blocks and " + std::to_string(stats.allocations) + " allocations instead of " + std::to_string(firstLoadStats.blockAllocations) + " and " + std::to_string(firstLoadStats.allocations));
+
+		//enemies coming and going during play stay inside what the map reserved
+		EntityStore& entities = world->GetEntities();
+		for (int cycle = 0; cycle < 10; cycle++)
+		{
+			std::vector<int> spawned;
+			for (int i = 0; i < ENTITY_RUNTIME_ENEMY_CAPACITY; i++)
+			{
+				spawned.push_back(entities.SpawnEnemy(getTestDefinition(5000 + i, false, true)));
+			}
+
+			for (int index : spawned)
+			{
+				entities.Kill(index);
+			}
+
+			world->ResetEntities();
+		}
+
+		expect(entities.GetCount() == entityCount + ENTITY_RUNTIME_ENEMY_CAPACITY, mapName + " has " + std::to_string(entities.GetCount()) + " entities after spawning and killing enemies, expected " + std::to_string(entityCount + ENTITY_RUNTIME_ENEMY_CAPACITY));
+		expect(haveSameAllocations(world->GetArenaStats(), stats), "Spawning and killing enemies on " + mapName + " grew its arena");
+
+		delete world;
+	}
+}
+
+int main()
+{
+	//headless, entity textures still get decoded through the texture cache
+	if (!Display::Initialize(true))
+		return 1;
+
+	//teleporters refer to other maps by name, so the registry has to know them
+	if (!MapRegistry::Initialize(MAPS_MANIFEST_FILEPATH))
+	{
+		printf("Couldn't read %s\n", MAPS_MANIFEST_FILEPATH);
+		return 1;
+	}
+
+	testEnemySlotReuse();
+	testStoreArenaBlocks();
+
+	ThreadPool threadPool(ThreadPool::GetDefaultThreadCount());
+	for (int mapHandle = 0; mapHandle < MapRegistry::GetCount(); mapHandle++)
+	{
+		testWorldArena(mapHandle, &threadPool);
+	}
+
+	Display::ShutDown();
+
+	if (failureCount > 0)
+	{
+		printf("%d failures\n", failureCount);
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
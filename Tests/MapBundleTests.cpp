@@ -0,0 +1,148 @@
+#include "MapBundle.h"
+#include "MapRegistry.h"
+#include "TilesetRegistry.h"
+#include "ThreadPool.h"
+#include "Constants.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+//bundles have to be rejected when a tile id doesn't fit the tileset or the .csv files changed since they were built
+//run from BlizzGameJam2021/ like the game, with a scratch directory to build bundles in
+
+static int failureCount = 0;
+
+static void expect(bool condition, const char* description)
+{
+	if (condition)
+		return;
+
+	printf("%s\n", description);
+	failureCount++;
+}
+
+static bool copyFile(const std::string& sourceFilePath, const std::string& destinationFilePath, const std::string& suffix)
+{
+	std::ifstream source(sourceFilePath.c_str(), std::ios::binary);
+	std::ofstream destination(destinationFilePath.c_str(), std::ios::binary | std::ios::trunc);
+	if (!source.is_open() || !destination.is_open())
+	{
+		printf("Unable to copy %s to %s\n", sourceFilePath.c_str(), destinationFilePath.c_str());
+		return false;
+	}
+
+	destination << source.rdbuf() << suffix;
+
+	return true;
+}
+
+int main(int argc, char* args[])
+{
+	if (argc != 2)
+	{
+		printf("Usage: MapBundleTests <scratch directory>\n");
+		return 1;
+	}
+
+	const std::string directory = std::string(args[1]) + "/";
+	ThreadPool threadPool(ThreadPool::GetDefaultThreadCount());
+
+	//teleporters refer to other maps by name, so the registry has to know them
+	if (!MapRegistry::Initialize(MAPS_MANIFEST_FILEPATH))
+	{
+		printf("Couldn't read %s\n", MAPS_MANIFEST_FILEPATH);
+		return 1;
+	}
+
+	//starting_house's .csv export, copied so the test can edit it
+	const char* sourceFileNames[] = { "starting_house_Base.csv", "starting_house_Objects-low.csv", "starting_house_Objects-high.csv", "starting_house_teleporters.txt", "starting_house_spawns.txt" };
+	for (const char* sourceFileName : sourceFileNames)
+	{
+		if (!copyFile(std::string("../resources/maps/") + sourceFileName, directory + sourceFileName, ""))
+			return 1;
+	}
+
+	MapDefinition definition;
+	definition.name = "starting_house";
+	definition.mapFilePathsByLayer = { directory + sourceFileNames[0], directory + sourceFileNames[1], directory + sourceFileNames[2] };
+	definition.tilesetFilePath = "../resources/Raou_Interior_Tileset.tsx";
+	definition.tilesetHandle = TilesetRegistry::Load(definition.tilesetFilePath);
+	definition.teleportersFilePath = directory + sourceFileNames[3];
+	definition.spawnsFilePath = directory + sourceFileNames[4];
+	definition.bundleFilePath = directory + "starting_house" + MAP_BUNDLE_FILE_EXTENSION;
+
+	if (definition.tilesetHandle == INVALID_TILESET_HANDLE || !MapBundle::Compile(definition, definition.bundleFilePath, &threadPool))
+	{
+		printf("Couldn't compile %s\n", definition.bundleFilePath.c_str());
+		return 1;
+	}
+
+	{
+		MapBundle bundle(definition.bundleFilePath);
+		expect(bundle.Open(definition), "a freshly built bundle didn't open");
+	}
+
+	//one tile id past the end of the tileset
+	std::string bundleData;
+	{
+		std::ifstream file(definition.bundleFilePath.c_str(), std::ios::binary);
+		std::ostringstream contents;
+		contents << file.rdbuf();
+		bundleData = contents.str();
+	}
+
+	MapBundleHeader header;
+	memcpy(&header, bundleData.data(), sizeof(MapBundleHeader));
+
+	const uint16_t badTileId = static_cast<uint16_t>(TilesetRegistry::Get(definition.tilesetHandle).tileCount);
+	const size_t lastTileIdOffset = header.layersOffset + (static_cast<size_t>(header.rowCount) * header.columnCount * header.layerCount - 1) * sizeof(uint16_t);
+	memcpy(&bundleData[lastTileIdOffset], &badTileId, sizeof(uint16_t));
+
+	MapDefinition badTileDefinition = definition;
+	badTileDefinition.bundleFilePath = directory + "bad_tile" + MAP_BUNDLE_FILE_EXTENSION;
+	{
+		std::ofstream file(badTileDefinition.bundleFilePath.c_str(), std::ios::binary | std::ios::trunc);
+		file.write(bundleData.data(), bundleData.size());
+	}
+
+	{
+		MapBundle bundle(badTileDefinition.bundleFilePath);
+		expect(!bundle.Open(badTileDefinition), "a bundle with a tile id past the end of the tileset opened");
+	}
+
+	//editing any of the files it was built from makes the bundle stale, a trailing newline changes nothing but the size
+	for (const char* sourceFileName : sourceFileNames)
+	{
+		const std::string sourceFilePath = directory + sourceFileName;
+		const std::string originalFilePath = sourceFilePath + ".original";
+
+		{
+			MapBundle bundle(definition.bundleFilePath);
+			expect(MapBundle::Compile(definition, definition.bundleFilePath, &threadPool) && bundle.Open(definition), "a rebuilt bundle didn't open");
+		}
+
+		copyFile(sourceFilePath, originalFilePath, "");
+		copyFile(originalFilePath, sourceFilePath, "\n");
+
+		{
+			MapBundle bundle(definition.bundleFilePath);
+			if (bundle.Open(definition))
+			{
+				printf("The bundle still opened after %s changed\n", sourceFileName);
+				failureCount++;
+			}
+		}
+
+		copyFile(originalFilePath, sourceFilePath, "");
+		remove(originalFilePath.c_str());
+	}
+
+	if (failureCount > 0)
+	{
+		printf("%d failures\n", failureCount);
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include "MapChunkStreamer.h"
+#include "CsvMapLoader.h"
+#include "TilesetRegistry.h"
+#include "ThreadPool.h"
+#include "Constants.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+
+//streamed chunks have to come out tile for tile the same as CsvMapLoader reads the whole file, and a chunk with a malformed row must fail instead of loading
+//run from BlizzGameJam2021/ like the game, with a scratch directory for the generated layer files
+
+#define TEST_MAP_ROW_COUNT			80		//three chunk rows, the last one short
+#define TEST_MAP_COLUMN_COUNT		50		//two chunk columns, the last one short
+#define TEST_MAP_CHUNK_ROW_COUNT	3
+#define TEST_MAP_CHUNK_COLUMN_COUNT	2
+
+static int failureCount = 0;
+
+static void expect(bool condition, const std::string& description)
+{
+	if (condition)
+		return;
+
+	printf("%s\n", description.c_str());
+	failureCount++;
+}
+
+static int getTestTileId(const Tileset& tileset, int layer, int row, int column)
+{
+	//some empty cells too, they go through the same -1 rule as every other map
+	if ((row + column + layer) % 11 == 0)
+		return -1;
+
+	return ((row * 7) + (column * 3) + layer) % tileset.tileCount;
+}
+
+//a layer file with a few rows broken on purpose, each break is given as { row, column, what to write there }
+struct TestRowBreak
+{
+	int row;
+	int column;
+	const char* replacement;	//written instead of the tile id, an empty string drops the column
+};
+
+static bool writeLayerFile(const std::string& filepath, const Tileset& tileset, int layer, const std::vector<TestRowBreak>& rowBreaks)
+{
+	std::ofstream file(filepath.c_str(), std::ios::trunc);
+	if (!file.is_open())
+	{
+		printf("Unable to write %s\n", filepath.c_str());
+		return false;
+	}
+
+	for (int row = 0; row < TEST_MAP_ROW_COUNT; row++)
+	{
+		std::string line;
+		for (int column = 0; column < TEST_MAP_COLUMN_COUNT; column++)
+		{
+			std::string field = std::to_string(getTestTileId(tileset, layer, row, column));
+			for (const TestRowBreak& rowBreak : rowBreaks)
+			{
+				if (rowBreak.row == row && rowBreak.column == column)
+					field = rowBreak.replacement;
+			}
+
+			if (field.empty())
+				continue;
+
+			line += (line.empty() ? "" : ",") + field;
+		}
+
+		file << line << "\n";
+	}
+
+	return true;
+}
+
+//requests every chunk and waits until the worker has dealt with all of them
+static void streamWholeMap(MapChunkStreamer& streamer)
+{
+	const int chunkCount = TEST_MAP_CHUNK_ROW_COUNT * TEST_MAP_CHUNK_COLUMN_COUNT;
+
+	for (int attempt = 0; attempt < 5000; attempt++)
+	{
+		streamer.Update(0, 0, TEST_MAP_CHUNK_ROW_COUNT - 1, TEST_MAP_CHUNK_COLUMN_COUNT - 1);
+
+		const MapChunkStreamingStats& stats = streamer.GetStats();
+		if (static_cast<int>(stats.chunksLoaded + stats.chunksFailed) >= chunkCount)
+			return;
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+static void testWellFormedMap(const std::string& directory, TilesetHandle tilesetHandle, ThreadPool* threadPool)
+{
+	const Tileset& tileset = TilesetRegistry::Get(tilesetHandle);
+	const std::vector<std::string> tileDataFilePathsByLayer = { directory + "streamer_good_0.csv", directory + "streamer_good_1.csv" };
+	if (!writeLayerFile(tileDataFilePathsByLayer[0], tileset, 0, {}) || !writeLayerFile(tileDataFilePathsByLayer[1], tileset, 1, {}))
+	{
+		expect(false, "Couldn't write the well formed map");
+		return;
+	}
+
+	std::vector<std::vector<MapTile>> expectedTilesByLayer;
+	int expectedRowCount = 0;
+	int expectedColumnCount = 0;
+	if (!CsvMapLoader::Load(tileDataFilePathsByLayer, tilesetHandle, threadPool, expectedTilesByLayer, expectedRowCount, expectedColumnCount))
+	{
+		expect(false, "CsvMapLoader couldn't load the well formed map");
+		return;
+	}
+
+	MapChunkStreamer streamer(tileDataFilePathsByLayer, tilesetHandle, MAP_RESIDENT_CHUNK_BUDGET);
+	if (!streamer.Initialize(threadPool))
+	{
+		expect(false, "The streamer couldn't index the well formed map");
+		return;
+	}
+
+	expect(streamer.GetRowCount() == expectedRowCount && streamer.GetColumnCount() == expectedColumnCount, "The streamer and CsvMapLoader disagree on the size of the well formed map");
+	expect(streamer.GetChunkRowCount() == TEST_MAP_CHUNK_ROW_COUNT && streamer.GetChunkColumnCount() == TEST_MAP_CHUNK_COLUMN_COUNT, "The well formed map isn't cut into the expected chunks");
+
+	streamWholeMap(streamer);
+	expect(streamer.GetStats().chunksFailed == 0, "A chunk of the well formed map failed to load");
+
+	int mismatchCount = 0;
+	for (int row = 0; row < expectedRowCount; row++)
+	{
+		for (int column = 0; column < expectedColumnCount; column++)
+		{
+			const MapChunk* chunk = streamer.GetChunk(row / MAP_CHUNK_SIZE, column / MAP_CHUNK_SIZE);
+			if (chunk == nullptr)
+			{
+				mismatchCount++;
+				continue;
+			}
+
+			for (size_t layer = 0; layer < expectedTilesByLayer.size(); layer++)
+			{
+				const MapTile& tile = chunk->tilesByLayer[layer][((row % MAP_CHUNK_SIZE) * chunk->columnCount) + (column % MAP_CHUNK_SIZE)];
+				if (tile.GetId() != expectedTilesByLayer[layer][(row * expectedColumnCount) + column].GetId())
+					mismatchCount++;
+			}
+		}
+	}
+
+	expect(mismatchCount == 0, std::to_string(mismatchCount) + " streamed tiles of the well formed map differ from CsvMapLoader's");
+}
+
+static void testMalformedMap(const std::string& directory, TilesetHandle tilesetHandle, ThreadPool* threadPool)
+{
+	const Tileset& tileset = TilesetRegistry::Get(tilesetHandle);
+	const std::string tileIdPastTheEnd = std::to_string(tileset.tileCount);
+	const std::string tileIdAndAnExtraColumn = std::to_string(getTestTileId(tileset, 1, 70, TEST_MAP_COLUMN_COUNT - 1)) + ",0";
+
+	//a short row in chunk row 0, a tile id the tileset doesn't have in chunk (1, 1) and a long row in chunk row 2, only chunk (1, 0) is left intact
+	const std::vector<TestRowBreak> rowBreaks =
+	{
+		{ 3, 10, "" },
+		{ 40, 40, tileIdPastTheEnd.c_str() },
+		{ 70, TEST_MAP_COLUMN_COUNT - 1, tileIdAndAnExtraColumn.c_str() },
+	};
+
+	const std::vector<std::string> tileDataFilePathsByLayer = { directory + "streamer_bad_0.csv", directory + "streamer_bad_1.csv" };
+	if (!writeLayerFile(tileDataFilePathsByLayer[0], tileset, 0, {}) || !writeLayerFile(tileDataFilePathsByLayer[1], tileset, 1, rowBreaks))
+	{
+		expect(false, "Couldn't write the malformed map");
+		return;
+	}
+
+	//the loader the streamer stands in for rejects this file outright
+	std::vector<std::vector<MapTile>> tilesByLayer;
+	int rowCount = 0;
+	int columnCount = 0;
+	expect(!CsvMapLoader::Load(tileDataFilePathsByLayer, tilesetHandle, threadPool, tilesByLayer, rowCount, columnCount), "CsvMapLoader loaded the malformed map");
+
+	MapChunkStreamer streamer(tileDataFilePathsByLayer, tilesetHandle, MAP_RESIDENT_CHUNK_BUDGET);
+	if (!streamer.Initialize(threadPool))
+	{
+		expect(false, "The streamer couldn't index the malformed map");
+		return;
+	}
+
+	streamWholeMap(streamer);
+
+	for (int chunkRow = 0; chunkRow < TEST_MAP_CHUNK_ROW_COUNT; chunkRow++)
+	{
+		for (int chunkColumn = 0; chunkColumn < TEST_MAP_CHUNK_COLUMN_COUNT; chunkColumn++)
+		{
+			const bool shouldLoad = chunkRow == 1 && chunkColumn == 0;
+			const std::string chunkName = "Chunk (" + std::to_string(chunkRow) + ", " + std::to_string(chunkColumn) + ") of the malformed map";
+
+			const MapChunk* chunk = streamer.GetChunk(chunkRow, chunkColumn);
+			if (shouldLoad)
+				expect(chunk != nullptr, chunkName + " didn't load");
+			else
+				expect(chunk == nullptr, chunkName + " was built from a bad row");
+		}
+	}
+
+	const MapChunkStreamingStats& stats = streamer.GetStats();
+	expect(stats.chunksLoaded == 1 && stats.chunksFailed == 5, "The malformed map loaded " + std::to_string(stats.chunksLoaded) + " chunks and failed " + std::to_string(stats.chunksFailed) + ", expected 1 and 5");
+
+	//failed chunks aren't asked for again however long they stay in view
+	for (int frame = 0; frame < 20; frame++)
+	{
+		streamer.Update(0, 0, TEST_MAP_CHUNK_ROW_COUNT - 1, TEST_MAP_CHUNK_COLUMN_COUNT - 1);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	expect(streamer.GetStats().chunksFailed == 5 && streamer.GetStats().chunksLoaded == 1, "The malformed map's failed chunks were requested again");
+}
+
+int main(int argc, char* args[])
+{
+	if (argc != 2)
+	{
+		printf("Usage: MapChunkStreamerTests <scratch directory>\n");
+		return 1;
+	}
+
+	const std::string directory = std::string(args[1]) + "/";
+
+	const TilesetHandle tilesetHandle = TilesetRegistry::Load("../resources/Raou_Interior_Tileset.tsx");
+	if (tilesetHandle == INVALID_TILESET_HANDLE)
+	{
+		printf("Couldn't load the interior tileset\n");
+		return 1;
+	}
+
+	ThreadPool threadPool(ThreadPool::GetDefaultThreadCount());
+	testWellFormedMap(directory, tilesetHandle, &threadPool);
+	testMalformedMap(directory, tilesetHandle, &threadPool);
+
+	TilesetRegistry::ShutDown();
+
+	if (failureCount > 0)
+	{
+		printf("%d failures\n", failureCount);
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
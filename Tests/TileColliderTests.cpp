@@ -0,0 +1,131 @@
+#include "TileCollider.h"
+#include "Map.h"
+#include "TmxLoader.h"
+#include "MapRegistry.h"
+#include "Constants.h"
+#include <cstdio>
+
+//boxes walking into walls have to stop exactly where Map::Draw() draws the wall, run from BlizzGameJam2021/ like the game
+
+#define BOX_SIZE 8
+
+static int failureCount = 0;
+
+static void expect(bool condition, const char* description, int row, int column)
+{
+	if (condition)
+		return;
+
+	printf("%s, tile (%d, %d)\n", description, row, column);
+	failureCount++;
+}
+
+static void testTileConversion()
+{
+	//tile 0 covers [-8, 8), tile 1 [8, 24) and tile -1 [-24, -8)
+	expect(Map::GetTileStart(0, TILE_WIDTH) == -(TILE_WIDTH / 2), "tile 0 starts half a tile before 0", 0, 0);
+	expect(Map::GetTileStart(3, TILE_WIDTH) == (3 * TILE_WIDTH) - (TILE_WIDTH / 2), "tile 3 starts half a tile before its centre", 0, 3);
+	expect(Map::GetTileAt(0.0, TILE_WIDTH) == 0, "0 is in tile 0", 0, 0);
+	expect(Map::GetTileAt(-(TILE_WIDTH / 2), TILE_WIDTH) == 0, "tile 0's first pixel is in tile 0", 0, 0);
+	expect(Map::GetTileAt(-(TILE_WIDTH / 2) - 0.01, TILE_WIDTH) == -1, "just left of tile 0 is in tile -1", 0, -1);
+	expect(Map::GetTileAt((TILE_WIDTH / 2) - 0.01, TILE_WIDTH) == 0, "tile 0's last pixel is in tile 0", 0, 0);
+	expect(Map::GetTileAt(TILE_WIDTH / 2, TILE_WIDTH) == 1, "tile 1's first pixel is in tile 1", 0, 1);
+
+	for (int tile = -4; tile < 4; tile++)
+	{
+		expect(Map::GetTileAt(Map::GetTileStart(tile, TILE_WIDTH), TILE_WIDTH) == tile, "a tile's start is in that tile", 0, tile);
+		expect(Map::GetTileAt(tile * TILE_WIDTH, TILE_WIDTH) == tile, "a tile's centre is in that tile", 0, tile);
+	}
+}
+
+static void testWallEdges(const Map& map)
+{
+	//an 8x8 box in the middle of every walkable tile walks a whole tile towards each wall next to it, it should end up flush with the wall's drawn edge
+	int wallCount = 0;
+
+	for (int row = 1; row < map.GetRowCount() - 1; row++)
+	{
+		for (int column = 1; column < map.GetColumnCount() - 1; column++)
+		{
+			if (!map.IsWalkable(row, column))
+				continue;
+
+			const double centerX = column * TILE_WIDTH;
+			const double centerY = row * TILE_HEIGHT;
+
+			if (!map.IsWalkable(row, column + 1))
+			{
+				double x = centerX;
+				double y = centerY;
+				const TileCollision collision = TileCollider::Move(&map, x, y, BOX_SIZE, BOX_SIZE, TILE_WIDTH, 0.0);
+				expect(collision.blockedX && x + (BOX_SIZE / 2) == Map::GetTileStart(column + 1, TILE_WIDTH), "didn't stop at the wall's drawn left edge", row, column + 1);
+				wallCount++;
+			}
+
+			if (!map.IsWalkable(row, column - 1))
+			{
+				double x = centerX;
+				double y = centerY;
+				const TileCollision collision = TileCollider::Move(&map, x, y, BOX_SIZE, BOX_SIZE, -TILE_WIDTH, 0.0);
+				expect(collision.blockedX && x - (BOX_SIZE / 2) == Map::GetTileStart(column, TILE_WIDTH), "didn't stop at the wall's drawn right edge", row, column - 1);
+				wallCount++;
+			}
+
+			if (!map.IsWalkable(row + 1, column))
+			{
+				double x = centerX;
+				double y = centerY;
+				const TileCollision collision = TileCollider::Move(&map, x, y, BOX_SIZE, BOX_SIZE, 0.0, TILE_HEIGHT);
+				expect(collision.blockedY && y + (BOX_SIZE / 2) == Map::GetTileStart(row + 1, TILE_HEIGHT), "didn't stop at the wall's drawn top edge", row + 1, column);
+				wallCount++;
+			}
+
+			if (!map.IsWalkable(row - 1, column))
+			{
+				double x = centerX;
+				double y = centerY;
+				const TileCollision collision = TileCollider::Move(&map, x, y, BOX_SIZE, BOX_SIZE, 0.0, -TILE_HEIGHT);
+				expect(collision.blockedY && y - (BOX_SIZE / 2) == Map::GetTileStart(row, TILE_HEIGHT), "didn't stop at the wall's drawn bottom edge", row - 1, column);
+				wallCount++;
+			}
+
+			//moving up to the tile's drawn edge never gets blocked, whatever is around it
+			double x = centerX;
+			double y = centerY;
+			const TileCollision collision = TileCollider::Move(&map, x, y, BOX_SIZE, BOX_SIZE, (TILE_WIDTH - BOX_SIZE) / 2, (TILE_HEIGHT - BOX_SIZE) / 2);
+			expect(!collision.blockedX && !collision.blockedY, "got blocked inside a walkable tile", row, column);
+		}
+	}
+
+	if (wallCount == 0)
+	{
+		printf("No walls found next to walkable tiles\n");
+		failureCount++;
+	}
+
+	printf("Tested %d wall edges\n", wallCount);
+}
+
+int main()
+{
+	testTileConversion();
+
+	//teleporters refer to other maps by name, so the registry has to know them
+	TmxMapData data;
+	if (!MapRegistry::Initialize(MAPS_MANIFEST_FILEPATH) || !TmxLoader::Load("../resources/maps/starting_house.tmx", data))
+	{
+		printf("Couldn't load starting_house.tmx\n");
+		return 1;
+	}
+
+	Map map(data);
+	testWallEdges(map);
+
+	if (failureCount > 0)
+	{
+		printf("%d failures\n", failureCount);
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include "TmxLoader.h"
+#include "CsvMapLoader.h"
+#include "Inflate.h"
+#include "MapRegistry.h"
+#include "TilesetRegistry.h"
+#include "ThreadPool.h"
+#include "Constants.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+//the shipped maps (base64 + zlib) and copies of them in Tests/Maps using the other layer encodings Tiled can save have to match the .csv export tile for tile
+//corrupt and truncated layer data has to fail the load, run from BlizzGameJam2021/ like the game
+
+static int failureCount = 0;
+
+static void expect(bool condition, const std::string& description)
+{
+	if (condition)
+		return;
+
+	printf("%s\n", description.c_str());
+	failureCount++;
+}
+
+static void testEncodings(const std::string& mapName, ThreadPool* threadPool)
+{
+	//the .csv export is the reference, it goes through the loader the manifest's .csv maps use
+	const std::string directory = "../resources/maps/";
+	const std::vector<std::string> tileDataFilePathsByLayer = { directory + mapName + "_Base.csv", directory + mapName + "_Objects-low.csv", directory + mapName + "_Objects-high.csv" };
+	const TilesetHandle tilesetHandle = TilesetRegistry::Load("../resources/Raou_Interior_Tileset.tsx");
+
+	std::vector<std::vector<MapTile>> expectedTilesByLayer;
+	int expectedRowCount = 0;
+	int expectedColumnCount = 0;
+	if (!CsvMapLoader::Load(tileDataFilePathsByLayer, tilesetHandle, threadPool, expectedTilesByLayer, expectedRowCount, expectedColumnCount))
+	{
+		expect(false, "Couldn't load the .csv export of " + mapName);
+		return;
+	}
+
+	const std::string tmxFilePaths[] =
+	{
+		directory + mapName + ".tmx",
+		"../Tests/Maps/" + mapName + "_csv.tmx",
+		"../Tests/Maps/" + mapName + "_base64.tmx",
+		"../Tests/Maps/" + mapName + "_gzip.tmx",
+	};
+
+	//objects aren't part of the layer data, every copy should still have the shipped map's
+	size_t expectedTeleporterCount = 0;
+	size_t expectedSpawnCount = 0;
+
+	for (const std::string& tmxFilePath : tmxFilePaths)
+	{
+		TmxMapData data;
+		if (!TmxLoader::Load(tmxFilePath, data))
+		{
+			expect(false, "Couldn't load " + tmxFilePath);
+			continue;
+		}
+
+		if (&tmxFilePath == &tmxFilePaths[0])
+		{
+			expectedTeleporterCount = data.teleporters.size();
+			expectedSpawnCount = data.spawns.size();
+		}
+
+		expect(data.rowCount == expectedRowCount && data.columnCount == expectedColumnCount, tmxFilePath + " has a different size");
+		expect(data.tilesByLayer.size() == expectedTilesByLayer.size(), tmxFilePath + " has a different number of layers");
+		expect(data.teleporters.size() == expectedTeleporterCount && data.spawns.size() == expectedSpawnCount, tmxFilePath + " has different objects");
+
+		for (size_t layer = 0; layer < data.tilesByLayer.size() && layer < expectedTilesByLayer.size(); layer++)
+		{
+			const std::vector<MapTile>& mapTiles = data.tilesByLayer[layer];
+			const std::vector<MapTile>& expectedMapTiles = expectedTilesByLayer[layer];
+
+			int differentTileCount = mapTiles.size() == expectedMapTiles.size() ? 0 : 1;
+			for (size_t i = 0; i < mapTiles.size() && i < expectedMapTiles.size(); i++)
+			{
+				if (mapTiles[i].GetId() != expectedMapTiles[i].GetId())
+					differentTileCount++;
+			}
+
+			expect(differentTileCount == 0, tmxFilePath + " layer " + std::to_string(layer) + " has " + std::to_string(differentTileCount) + " tiles different from the .csv export");
+		}
+	}
+}
+
+static void testBadStreams()
+{
+	//layer data cut in half, and a first deflate block with the reserved block type
+	const char* badTmxFilePaths[] = { "../Tests/Maps/starting_house_truncated.tmx", "../Tests/Maps/starting_house_corrupt.tmx" };
+	for (const char* badTmxFilePath : badTmxFilePaths)
+	{
+		TmxMapData data;
+		expect(!TmxLoader::Load(badTmxFilePath, data), std::string(badTmxFilePath) + " loaded");
+	}
+
+	//zlib has no end marker of its own, but losing any part of the deflate data (everything before the 4 byte checksum) has to fail
+	std::vector<unsigned char> bytes(256);
+	for (size_t i = 0; i < bytes.size(); i++)
+	{
+		bytes[i] = static_cast<unsigned char>((i * 7) % 13);
+	}
+
+	//zlib stream of the bytes above, one fixed huffman block
+	const unsigned char stream[] = { 0x78, 0xda, 0x63, 0x60, 0x67, 0xe4, 0x60, 0xe2, 0x64, 0xe6, 0x62, 0xe1, 0x66, 0xe5, 0x61, 0x63, 0x18, 0x79, 0x1c, 0x00, 0xfd, 0x0d, 0x05, 0xf7 };
+	const size_t streamLength = sizeof(stream);
+
+	std::vector<unsigned char> output;
+	expect(Inflate::Decompress(stream, streamLength, output) && output == bytes, "a whole zlib stream didn't decompress to what went in");
+
+	for (size_t length = 0; length < streamLength - 4; length++)
+	{
+		output.clear();
+		expect(!Inflate::Decompress(stream, length, output), "a zlib stream cut to " + std::to_string(length) + " bytes decompressed");
+	}
+}
+
+int main()
+{
+	//teleporters refer to other maps by name, so the registry has to know them
+	if (!MapRegistry::Initialize(MAPS_MANIFEST_FILEPATH))
+	{
+		printf("Couldn't read %s\n", MAPS_MANIFEST_FILEPATH);
+		return 1;
+	}
+
+	ThreadPool threadPool(ThreadPool::GetDefaultThreadCount());
+	testEncodings("starting_house", &threadPool);
+	testEncodings("test_building", &threadPool);
+	testBadStreams();
+
+	if (failureCount > 0)
+	{
+		printf("%d failures\n", failureCount);
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -1218,11 +1218,13 @@
  </tile>
  <tile id="243">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="244">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -1288,11 +1290,13 @@
  </tile>
  <tile id="257">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="258">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -1358,11 +1362,13 @@
  </tile>
  <tile id="271">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="272">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -1428,11 +1434,13 @@
  </tile>
  <tile id="285">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="286">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -1783,21 +1791,25 @@
  </tile>
  <tile id="356">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="357">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="358">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="359">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -1853,21 +1865,25 @@
  </tile>
  <tile id="370">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="371">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="372">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="373">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -1923,21 +1939,25 @@
  </tile>
  <tile id="384">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="385">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="386">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="387">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -1993,21 +2013,25 @@
  </tile>
  <tile id="398">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="399">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="400">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="401">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2033,16 +2057,19 @@
  </tile>
  <tile id="406">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="407">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="408">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2063,11 +2090,13 @@
  </tile>
  <tile id="412">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="413">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2113,11 +2142,13 @@
  </tile>
  <tile id="422">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="423">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2133,11 +2164,13 @@
  </tile>
  <tile id="426">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="427">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2173,6 +2206,7 @@
  </tile>
  <tile id="434">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2243,6 +2277,7 @@
  </tile>
  <tile id="448">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2253,11 +2288,13 @@
  </tile>
  <tile id="450">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="451">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2313,6 +2350,7 @@
  </tile>
  <tile id="462">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2383,26 +2421,31 @@
  </tile>
  <tile id="476">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="477">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="478">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="479">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="480">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2453,26 +2496,31 @@
  </tile>
  <tile id="490">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="491">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="492">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="493">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="494">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2523,26 +2571,31 @@
  </tile>
  <tile id="504">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="505">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="506">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="507">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="508">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2593,21 +2646,25 @@
  </tile>
  <tile id="518">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="519">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="520">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="521">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2618,16 +2675,19 @@
  </tile>
  <tile id="523">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="524">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="525">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2663,16 +2723,19 @@
  </tile>
  <tile id="532">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="533">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="534">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2683,11 +2746,13 @@
  </tile>
  <tile id="536">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="537">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2698,6 +2763,7 @@
  </tile>
  <tile id="539">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -2733,1506 +2799,1807 @@
  </tile>
  <tile id="546">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="547">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="548">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="549">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="550">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="551">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="552">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="553">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="554">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="555">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="556">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="557">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="558">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="559">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="560">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="561">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="562">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="563">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="564">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="565">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="566">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="567">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="568">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="569">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="570">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="571">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="572">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="573">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="574">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="575">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="576">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="577">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="578">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="579">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="580">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="581">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="582">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="583">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="584">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="585">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="586">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="587">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="588">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="589">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="590">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="591">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="592">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="593">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="594">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="595">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="596">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="597">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="598">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="599">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="600">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="601">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="602">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="603">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="604">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="605">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="606">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="607">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="608">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="609">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="610">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="611">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="612">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="613">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="614">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="615">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="616">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="617">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="618">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="619">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="620">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="621">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="622">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="623">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="624">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="625">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="626">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="627">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="628">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="629">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="630">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="631">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="632">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="633">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="634">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="635">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="636">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="637">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="638">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="639">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="640">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="641">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="642">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="643">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="644">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="645">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="646">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="647">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="648">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="649">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="650">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="651">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="652">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="653">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="654">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="655">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="656">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="657">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="658">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="659">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="660">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="661">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="662">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="663">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="664">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="665">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="666">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="667">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="668">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="669">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="670">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="671">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="672">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="673">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="674">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="675">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="676">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="677">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="678">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="679">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="680">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="681">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="682">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="683">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="684">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="685">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="686">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="687">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="688">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="689">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="690">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="691">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="692">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="693">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="694">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="695">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="696">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="697">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="698">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="699">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="700">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="701">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="702">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="703">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="704">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="705">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="706">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="707">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="708">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="709">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="710">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="711">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="712">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="713">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="714">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="715">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="716">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="717">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="718">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="719">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="720">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="721">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="722">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="723">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="724">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="725">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="726">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="727">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="728">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="729">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="730">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="731">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="732">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="733">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="734">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="735">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="736">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="737">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="738">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="739">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="740">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="741">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="742">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="743">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="744">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="745">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="746">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="747">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="748">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="749">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="750">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="751">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="752">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="753">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="754">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="755">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="756">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="757">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="758">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="759">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="760">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="761">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="762">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="763">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="764">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="765">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="766">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="767">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="768">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="769">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="770">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="771">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="772">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="773">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="774">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="775">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="776">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="777">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="778">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="779">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="780">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="781">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="782">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="783">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="784">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="785">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="786">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="787">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="788">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="789">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="790">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="791">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="792">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="793">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="794">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="795">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="796">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="797">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="798">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="799">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="800">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="801">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="802">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="803">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="804">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="805">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="806">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="807">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="808">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="809">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="810">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="811">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="812">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="813">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="814">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="815">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="816">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="817">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="818">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="819">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="820">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="821">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="822">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="823">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="824">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="825">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="826">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="827">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="828">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="829">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="830">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="831">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="832">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="833">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="834">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="835">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="836">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="837">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="838">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="839">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="840">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="841">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="842">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="843">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="844">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="845">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
  <tile id="846">
   <properties>
+   <property name="isObject" type="bool" value="true"/>
    <property name="walkable" type="bool" value="false"/>
   </properties>
  </tile>
@@ -4268,7 +4635,7 @@
  </tile>
  <tile id="853">
   <properties>
-   <property name="walkable" type="bool" value="false"/>
+   <property name="walkable" type="bool" value="true"/>
   </properties>
  </tile>
 </tileset>